@@ -10,6 +10,7 @@
 #include "catch.hpp"
 #include <array>
 #include <process.h>
+#include <io.h>
 #include <suppress.h>
 
 #pragma warning(disable:4100) // unreferenced formal parameter
@@ -2688,6 +2689,36 @@ namespace JsRTApiTest
         REQUIRE(JsCopyString(result,utf8Result, 10, &written) == JsNoError);
         CHECK(written == strlen(validUtf8Input));
         CHECK(memcmp(utf8Result, validUtf8Input, written) == 0);
+
+        // Long ASCII strings are kept at one byte per character; copying out must give the same
+        // results before and after the string is widened by script
+        const char asciiInput[] = "https://example.org/path?query=value";
+        const size_t asciiLength = strlen(asciiInput);
+        REQUIRE(JsCreateString(asciiInput, asciiLength, &result) == JsNoError);
+        char asciiResult[64];
+        for (int pass = 0; pass < 2; pass++)
+        {
+            REQUIRE(JsCopyString(result, nullptr, 0, &written) == JsNoError);
+            CHECK(written == asciiLength);
+            REQUIRE(JsCopyString(result, asciiResult, 5, &written) == JsNoError);
+            CHECK(written == 5);
+            REQUIRE(JsCopyString(result, asciiResult, sizeof(asciiResult), &written) == JsNoError);
+            CHECK(written == asciiLength);
+            CHECK(memcmp(asciiResult, asciiInput, asciiLength) == 0);
+            REQUIRE(JsCopyStringOneByte(result, 8, 100, asciiResult, &written) == JsNoError);
+            CHECK(written == asciiLength - 8);
+            CHECK(memcmp(asciiResult, asciiInput + 8, written) == 0);
+            REQUIRE(JsCopyStringUtf16(result, 0, 2, utf16Result, &written) == JsNoError);
+            CHECK(written == 2);
+            CHECK(utf16Result[0] == 'h');
+
+            // Widen it
+            const WCHAR* widened = nullptr;
+            size_t widenedLength = 0;
+            REQUIRE(JsStringToPointer(result, &widened, &widenedLength) == JsNoError);
+            CHECK(widenedLength == asciiLength);
+            CHECK(widened[asciiLength] == _u('\0'));
+        }
     }
 
     TEST_CASE("ApiTest_JsCreateStringTest", "[ApiTest]")
@@ -2847,4 +2878,319 @@ namespace JsRTApiTest
     {
         JsRTApiTest::RunWithAttributes(JsRTApiTest::JsCreatePromiseTest);
     }
+
+    // Sets config flags through the test hooks, the first argument is skipped like a program name
+    void SetConfigFlags(std::initializer_list<const char16*> flags)
+    {
+        REQUIRE(g_testHooksLoaded);
+        std::vector<LPWSTR> argv;
+        argv.push_back(const_cast<LPWSTR>(_u("NativeTests.exe")));
+        for (const char16* flag : flags)
+        {
+            argv.push_back(const_cast<LPWSTR>(flag));
+        }
+        REQUIRE(g_testHooks.pfSetConfigFlags((int)argv.size(), argv.data(), nullptr) == S_OK);
+    }
+
+    // Runs a script with stdout redirected, and returns its result and what the engine traced
+    std::string RunScriptCapturingOutput(const wchar_t* script, JsSourceContext sourceContext, int* result)
+    {
+        FILE* capture = nullptr;
+        REQUIRE(tmpfile_s(&capture) == 0);
+        fflush(stdout);
+        int savedStdout = _dup(_fileno(stdout));
+        REQUIRE(savedStdout != -1);
+        REQUIRE(_dup2(_fileno(capture), _fileno(stdout)) == 0);
+
+        JsValueRef resultRef = JS_INVALID_REFERENCE;
+        JsErrorCode error = JsRunScript(script, sourceContext, _u("reloaded.js"), &resultRef);
+
+        fflush(stdout);
+        _dup2(savedStdout, _fileno(stdout));
+        _close(savedStdout);
+
+        std::string output;
+        char buffer[256];
+        size_t read;
+        rewind(capture);
+        while ((read = fread(buffer, 1, sizeof(buffer), capture)) != 0)
+        {
+            output.append(buffer, read);
+        }
+        fclose(capture);
+
+        REQUIRE(error == JsNoError);
+        REQUIRE(JsNumberToInt(resultRef, result) == JsNoError);
+        return output;
+    }
+
+    // Turns on incremental reparse, with deferred parsing so that there are functions to reuse and the trace that
+    // shows the reuse, and turns all three off again when it goes out of scope, also when a check fails
+    class AutoIncrementalReparseFlags
+    {
+    public:
+        AutoIncrementalReparseFlags()
+        {
+            SetConfigFlags({ _u("-IncrementalReparse"), _u("-ForceDeferParse"), _u("-trace:IncrementalReparse") });
+        }
+
+        ~AutoIncrementalReparseFlags()
+        {
+            SetConfigFlags({ _u("-IncrementalReparse-"), _u("-ForceDeferParse-"), _u("-trace:IncrementalReparse-") });
+        }
+    };
+
+    void IncrementalReparseTest(JsRuntimeAttributes /*attributes*/, JsRuntimeHandle /*runtime*/)
+    {
+        const JsSourceContext reloadedContext = 0x1000;
+        int result = 0;
+
+        // The first version compiles both functions when it calls them
+        std::string output = RunScriptCapturingOutput(
+            _u("function unchanged(a) { return a + 1; }\n")
+            _u("function edited(a) { return a * 2; }\n")
+            _u("function shifted(a) { return a - 1; }\n")
+            _u("unchanged(1) + edited(10) + shifted(100);\n"),
+            reloadedContext, &result);
+        CHECK(result == 2 + 20 + 99);
+        CHECK(output.find("reusing") == std::string::npos);
+
+        // Reloading with an edit reuses the function before the edit and compiles the others again
+        output = RunScriptCapturingOutput(
+            _u("function unchanged(a) { return a + 1; }\n")
+            _u("function edited(a) { return a * 3 + 0; }\n")
+            _u("function shifted(a) { return a - 1; }\n")
+            _u("unchanged(1) + edited(10) + shifted(100) + unchanged.toString().length;\n"),
+            reloadedContext, &result);
+        CHECK(result == 2 + 30 + 99 + 39);
+        CHECK(output.find("reusing unchanged") != std::string::npos);
+        CHECK(output.find("reusing edited") == std::string::npos);
+        CHECK(output.find("reusing shifted") == std::string::npos);
+
+        // Only a source loaded with the same source context is a previous version
+        output = RunScriptCapturingOutput(
+            _u("function unchanged(a) { return a + 1; }\n")
+            _u("unchanged(41);\n"),
+            reloadedContext + 1, &result);
+        CHECK(result == 42);
+        CHECK(output.find("reusing") == std::string::npos);
+    }
+
+    TEST_CASE("ApiTest_IncrementalReparseTest", "[ApiTest]")
+    {
+        // The reuse is only observable through the trace, which needs a build with test hooks
+        if (!g_testHooksLoaded)
+        {
+            WARN("Skipped: the incremental reparse trace is not available in this build");
+            return;
+        }
+
+        JsRTApiTest::AutoIncrementalReparseFlags flags;
+        JsRTApiTest::WithSetup(JsRuntimeAttributeNone, JsRTApiTest::IncrementalReparseTest);
+    }
+
+    void CALLBACK JsonStringifyChunkCallback(const char *chunk, size_t length, void *callbackState)
+    {
+        std::vector<char>* output = static_cast<std::vector<char>*>(callbackState);
+        output->insert(output->end(), chunk, chunk + length);
+    }
+
+    void JsJsonStringifyUtf8Test(JsRuntimeAttributes /*attributes*/, JsRuntimeHandle /*runtime*/)
+    {
+        // Output spans many chunks and has surrogate pairs straddling chunk boundaries
+        JsValueRef value = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("(function() { var a = []; for (var i = 0; i < 3000; i++) { a.push({ k: '\\uD83D\\uDE00' + i }); } return a; })()"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+
+        std::vector<char> output;
+        bool isUndefined = true;
+        REQUIRE(JsJsonStringifyUtf8(value, nullptr, nullptr, JsonStringifyChunkCallback, &output, &isUndefined) == JsNoError);
+        CHECK(!isUndefined);
+
+        // JSON.stringify followed by a UTF-8 copy serves as the oracle
+        JsValueRef expectedString = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("JSON.stringify((function() { var a = []; for (var i = 0; i < 3000; i++) { a.push({ k: '\\uD83D\\uDE00' + i }); } return a; })())"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &expectedString) == JsNoError);
+        size_t expectedLength = 0;
+        REQUIRE(JsCopyString(expectedString, nullptr, 0, &expectedLength) == JsNoError);
+        std::vector<char> expected(expectedLength);
+        REQUIRE(JsCopyString(expectedString, expected.data(), expectedLength, nullptr) == JsNoError);
+        CHECK(output == expected);
+
+        // Values without a JSON representation report undefined and produce no output
+        output.clear();
+        REQUIRE(JsJsonStringifyUtf8(GetUndefined(), nullptr, nullptr, JsonStringifyChunkCallback, &output, &isUndefined) == JsNoError);
+        CHECK(isUndefined);
+        CHECK(output.empty());
+    }
+
+    TEST_CASE("ApiTest_JsJsonStringifyUtf8Test", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsJsonStringifyUtf8Test);
+    }
+
+    void WebAssemblyModuleStreamTest(JsRuntimeAttributes /*attributes*/, JsRuntimeHandle /*runtime*/)
+    {
+        // (module (func (export "ans") (result i32) (i32.const 42)))
+        const BYTE wasm[] = {
+            0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+            0x01, 0x05, 0x01, 0x60, 0x00, 0x01, 0x7f,
+            0x03, 0x02, 0x01, 0x00,
+            0x07, 0x07, 0x01, 0x03, 'a', 'n', 's', 0x00, 0x00,
+            0x0a, 0x06, 0x01, 0x04, 0x00, 0x41, 0x2a, 0x0b
+        };
+
+        JsValueRef instantiate = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("(function (m) { return new WebAssembly.Instance(m).exports.ans(); })"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &instantiate) == JsNoError);
+
+        // The same module delivered a byte at a time, in uneven chunks, and all at once
+        const unsigned int chunkSizes[] = { 1, 3, 7, _countof(wasm) };
+        for (unsigned int chunkSize : chunkSizes)
+        {
+            JsWebAssemblyModuleStream stream = nullptr;
+            REQUIRE(JsCreateWebAssemblyModuleStream(chunkSize == 1 ? 0 : _countof(wasm), &stream) == JsNoError);
+            for (unsigned int offset = 0; offset < _countof(wasm); offset += chunkSize)
+            {
+                unsigned int length = offset + chunkSize <= _countof(wasm) ? chunkSize : _countof(wasm) - offset;
+                REQUIRE(JsWebAssemblyModuleStreamAppend(stream, wasm + offset, length) == JsNoError);
+            }
+
+            JsValueRef module = JS_INVALID_REFERENCE;
+            REQUIRE(JsWebAssemblyModuleStreamFinish(stream, &module) == JsNoError);
+            REQUIRE(module != JS_INVALID_REFERENCE);
+
+            JsValueRef args[] = { GetUndefined(), module };
+            JsValueRef result = JS_INVALID_REFERENCE;
+            REQUIRE(JsCallFunction(instantiate, args, _countof(args), &result) == JsNoError);
+            int resultInt = 0;
+            REQUIRE(JsNumberToInt(result, &resultInt) == JsNoError);
+            CHECK(resultInt == 42);
+        }
+
+        // Something that is not a module fails on its first wrong byte, and the failed stream can only be finished
+        JsWebAssemblyModuleStream stream = nullptr;
+        JsValueRef exception = JS_INVALID_REFERENCE;
+        JsValueRef module = JS_INVALID_REFERENCE;
+        const BYTE notWasm[] = { 0x00, 'x' };
+        REQUIRE(JsCreateWebAssemblyModuleStream(0, &stream) == JsNoError);
+        REQUIRE(JsWebAssemblyModuleStreamAppend(stream, notWasm, _countof(notWasm)) == JsErrorScriptException);
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+        REQUIRE(JsWebAssemblyModuleStreamAppend(stream, wasm, _countof(wasm)) == JsErrorInvalidArgument);
+        REQUIRE(JsWebAssemblyModuleStreamFinish(stream, &module) == JsNoError);
+        CHECK(module == JS_INVALID_REFERENCE);
+
+        // A stream that ends inside a section fails when it is finished
+        REQUIRE(JsCreateWebAssemblyModuleStream(0, &stream) == JsNoError);
+        REQUIRE(JsWebAssemblyModuleStreamAppend(stream, wasm, _countof(wasm) - 1) == JsNoError);
+        REQUIRE(JsWebAssemblyModuleStreamFinish(stream, &module) == JsErrorScriptException);
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+        CHECK(module == JS_INVALID_REFERENCE);
+
+        // A stream can be abandoned
+        REQUIRE(JsCreateWebAssemblyModuleStream(0, &stream) == JsNoError);
+        REQUIRE(JsWebAssemblyModuleStreamAppend(stream, wasm, 8) == JsNoError);
+        REQUIRE(JsWebAssemblyModuleStreamFinish(stream, nullptr) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_WebAssemblyModuleStreamTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::WebAssemblyModuleStreamTest);
+    }
+
+    void WebAssemblyModuleSerializeTest(JsRuntimeAttributes /*attributes*/, JsRuntimeHandle /*runtime*/)
+    {
+        // (module (func (export "sum") (param i32) (result i32) (local i32)
+        //   (block (loop (br_if 1 (i32.eqz (get_local 0)))
+        //     (set_local 1 (i32.add (get_local 1) (get_local 0)))
+        //     (set_local 0 (i32.sub (get_local 0) (i32.const 1)))
+        //     (br 0)))
+        //   (get_local 1)))
+        const BYTE wasm[] = {
+            0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+            0x01, 0x06, 0x01, 0x60, 0x01, 0x7f, 0x01, 0x7f,
+            0x03, 0x02, 0x01, 0x00,
+            0x07, 0x07, 0x01, 0x03, 's', 'u', 'm', 0x00, 0x00,
+            0x0a, 0x23, 0x01, 0x21, 0x01, 0x01, 0x7f,
+            0x02, 0x40, 0x03, 0x40, 0x20, 0x00, 0x45, 0x0d, 0x01,
+            0x20, 0x01, 0x20, 0x00, 0x6a, 0x21, 0x01,
+            0x20, 0x00, 0x41, 0x01, 0x6b, 0x21, 0x00,
+            0x0c, 0x00, 0x0b, 0x0b, 0x20, 0x01, 0x0b
+        };
+
+        JsValueRef compile = JS_INVALID_REFERENCE;
+        JsValueRef sum = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("(function (b) { return new WebAssembly.Module(b); })"), JS_SOURCE_CONTEXT_NONE, _u(""), &compile) == JsNoError);
+        REQUIRE(JsRunScript(_u("(function (m, n) { return new WebAssembly.Instance(m).exports.sum(n); })"), JS_SOURCE_CONTEXT_NONE, _u(""), &sum) == JsNoError);
+
+        auto callSum = [&](JsValueRef module) -> int
+        {
+            JsValueRef n = JS_INVALID_REFERENCE;
+            REQUIRE(JsIntToNumber(10, &n) == JsNoError);
+            JsValueRef args[] = { GetUndefined(), module, n };
+            JsValueRef result = JS_INVALID_REFERENCE;
+            REQUIRE(JsCallFunction(sum, args, _countof(args), &result) == JsNoError);
+            int resultInt = 0;
+            REQUIRE(JsNumberToInt(result, &resultInt) == JsNoError);
+            return resultInt;
+        };
+
+        JsValueRef binary = JS_INVALID_REFERENCE;
+        BYTE* binaryStorage = nullptr;
+        unsigned int binaryLength = 0;
+        REQUIRE(JsCreateArrayBuffer(_countof(wasm), &binary) == JsNoError);
+        REQUIRE(JsGetArrayBufferStorage(binary, &binaryStorage, &binaryLength) == JsNoError);
+        memcpy(binaryStorage, wasm, _countof(wasm));
+
+        JsValueRef args[] = { GetUndefined(), binary };
+        JsValueRef module = JS_INVALID_REFERENCE;
+        REQUIRE(JsCallFunction(compile, args, _countof(args), &module) == JsNoError);
+
+        // Serialized both before and after the function has run
+        for (int i = 0; i < 2; i++)
+        {
+            if (i == 1)
+            {
+                CHECK(callSum(module) == 55);
+            }
+
+            JsValueRef serialized = JS_INVALID_REFERENCE;
+            REQUIRE(JsSerializeWebAssemblyModule(module, &serialized) == JsNoError);
+
+            JsValueRef deserialized = JS_INVALID_REFERENCE;
+            REQUIRE(JsDeserializeWebAssemblyModule(serialized, &deserialized) == JsNoError);
+            CHECK(callSum(deserialized) == 55);
+            CHECK(callSum(deserialized) == 55);
+        }
+
+        JsValueRef serialized = JS_INVALID_REFERENCE;
+        BYTE* storage = nullptr;
+        unsigned int length = 0;
+        REQUIRE(JsSerializeWebAssemblyModule(module, &serialized) == JsNoError);
+        REQUIRE(JsGetArrayBufferStorage(serialized, &storage, &length) == JsNoError);
+
+        // Anything that doesn't come from the same engine intact is rejected, for the host to compile the binary instead
+        JsValueRef deserialized = JS_INVALID_REFERENCE;
+        storage[length - 1] ^= 0xff;
+        CHECK(JsDeserializeWebAssemblyModule(serialized, &deserialized) == JsErrorBadSerializedScript);
+        CHECK(deserialized == JS_INVALID_REFERENCE);
+        storage[length - 1] ^= 0xff;
+
+        JsValueRef truncated = JS_INVALID_REFERENCE;
+        BYTE* truncatedStorage = nullptr;
+        unsigned int truncatedLength = 0;
+        REQUIRE(JsCreateArrayBuffer(length - 1, &truncated) == JsNoError);
+        REQUIRE(JsGetArrayBufferStorage(truncated, &truncatedStorage, &truncatedLength) == JsNoError);
+        memcpy(truncatedStorage, storage, truncatedLength);
+        CHECK(JsDeserializeWebAssemblyModule(truncated, &deserialized) == JsErrorBadSerializedScript);
+        CHECK(JsDeserializeWebAssemblyModule(binary, &deserialized) == JsErrorBadSerializedScript);
+
+        CHECK(JsSerializeWebAssemblyModule(binary, &serialized) == JsErrorInvalidArgument);
+        CHECK(JsDeserializeWebAssemblyModule(module, &deserialized) == JsErrorInvalidArgument);
+    }
+
+    TEST_CASE("ApiTest_WebAssemblyModuleSerializeTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::WebAssemblyModuleSerializeTest);
+    }
 }
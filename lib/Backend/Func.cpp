@@ -873,7 +873,9 @@ Func::AjustLocalVarSlotOffset()
 bool
 Func::DoSimpleJitDynamicProfile() const
 {
-    return IsSimpleJit() && !PHASE_OFF(Js::SimpleJitDynamicProfilePhase, GetTopFunc()) && !CONFIG_FLAG(NewSimpleJit);
+    // WebAssembly baseline code has nothing to profile
+    return IsSimpleJit() && !PHASE_OFF(Js::SimpleJitDynamicProfilePhase, GetTopFunc()) && !CONFIG_FLAG(NewSimpleJit) &&
+        !GetJITFunctionBody()->IsAsmJsMode();
 }
 
 void
@@ -884,7 +886,7 @@ Func::SetDoFastPaths()
 
     bool doFastPaths = false;
 
-    if(!PHASE_OFF(Js::FastPathPhase, this) && (!IsSimpleJit() || CONFIG_FLAG(NewSimpleJit)))
+    if(!PHASE_OFF(Js::FastPathPhase, this) && (!IsSimpleJit() || CONFIG_FLAG(NewSimpleJit) || GetJITFunctionBody()->IsAsmJsMode()))
     {
         doFastPaths = true;
     }
@@ -3738,6 +3738,12 @@ GlobOpt::CopyProp(IR::Opnd *opnd, IR::Instr *instr, Value *val, IR::IndirOpnd *p
         return opnd;
     }
 
+    // The wasm bulk memory operators also link to their own ExtendedArgs through src2
+    if ((instr->m_opcode == Js::OpCode::WasmMemoryCopy || instr->m_opcode == Js::OpCode::WasmMemoryFill) && opnd == instr->GetSrc2())
+    {
+        return opnd;
+    }
+
     // Don't copy-prop operand of SIMD instr with ExtendedArg operands. Each instr should have its exclusive EA sequence.
     if (
             Js::IsSimd128Opcode(instr->m_opcode) &&
@@ -2513,6 +2513,33 @@ IRBuilderAsmJs::BuildInt2(Js::OpCodeAsmJs newOpcode, uint32 offset, Js::RegSlot
     }
 }
 
+void
+IRBuilderAsmJs::BuildWasmBulkMemory(Js::OpCodeAsmJs newOpcode, uint32 offset, Js::RegSlot dstRegSlot, Js::RegSlot srcRegSlot, Js::RegSlot lengthRegSlot)
+{
+    IR::RegOpnd * dstOpnd = BuildSrcOpnd(dstRegSlot, TyUint32);
+    dstOpnd->SetValueType(ValueType::GetInt(false));
+
+    IR::RegOpnd * srcOpnd = BuildSrcOpnd(srcRegSlot, TyUint32);
+    srcOpnd->SetValueType(ValueType::GetInt(false));
+
+    IR::RegOpnd * lengthOpnd = BuildSrcOpnd(lengthRegSlot, TyUint32);
+    lengthOpnd->SetValueType(ValueType::GetInt(false));
+
+    // Given bytecode: op dst, src, length
+    // Generate:
+    // t1 = ExtendedArg_A dst
+    // t2 = ExtendedArg_A src, t1
+    // t3 = ExtendedArg_A length, t2
+    // op memory, t3
+    // The whole range is bounds checked once by the helper, which then copies or fills it with memmove/memset.
+    IR::Instr * instr = AddExtendedArg(dstOpnd, nullptr, offset);
+    instr = AddExtendedArg(srcOpnd, instr->GetDst()->AsRegOpnd(), offset);
+    instr = AddExtendedArg(lengthOpnd, instr->GetDst()->AsRegOpnd(), offset);
+
+    Js::OpCode opcode = newOpcode == Js::OpCodeAsmJs::MemoryCopy ? Js::OpCode::WasmMemoryCopy : Js::OpCode::WasmMemoryFill;
+    AddInstr(IR::Instr::New(opcode, m_func, BuildSrcOpnd(AsmJsRegSlots::WasmMemoryReg, TyVar), instr->GetDst()), offset);
+}
+
 IR::RegOpnd* IRBuilderAsmJs::BuildTrapIfZero(IR::RegOpnd* srcOpnd, uint32 offset)
 {
     IR::RegOpnd* newSrc = IR::RegOpnd::New(srcOpnd->GetType(), m_func);
@@ -2541,6 +2568,13 @@ IR::Instr* IRBuilderAsmJs::CreateSignExtendInstr(IR::Opnd* dst, IR::Opnd* src, I
 void
 IRBuilderAsmJs::BuildInt3(Js::OpCodeAsmJs newOpcode, uint32 offset, Js::RegSlot dstRegSlot, Js::RegSlot src1RegSlot, Js::RegSlot src2RegSlot)
 {
+    if (newOpcode == Js::OpCodeAsmJs::MemoryCopy || newOpcode == Js::OpCodeAsmJs::MemoryFill)
+    {
+        // All three registers are sources for the bulk memory operators
+        BuildWasmBulkMemory(newOpcode, offset, dstRegSlot, src1RegSlot, src2RegSlot);
+        return;
+    }
+
     IR::RegOpnd * src1Opnd = BuildSrcOpnd(src1RegSlot, TyInt32);
     src1Opnd->SetValueType(ValueType::GetInt(false));
 
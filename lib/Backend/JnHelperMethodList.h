@@ -91,6 +91,8 @@ HELPERCALLCHK(Op_Rem_Double, Js::NumberUtilities::Modulus, AttrCanNotBeReentrant
 #ifdef ENABLE_WASM
 HELPERCALLCHK(Op_CheckWasmSignature, Js::WebAssembly::CheckSignature, AttrCanThrow | AttrCanNotBeReentrant)
 HELPERCALLCHK(Op_GrowWasmMemory, Js::WebAssemblyMemory::GrowHelper, AttrCanNotBeReentrant)
+HELPERCALLCHK(Op_WasmMemoryCopy, Js::WebAssemblyMemory::CopyHelper, AttrCanThrow | AttrCanNotBeReentrant)
+HELPERCALLCHK(Op_WasmMemoryFill, Js::WebAssemblyMemory::FillHelper, AttrCanThrow | AttrCanNotBeReentrant)
 #if DBG
 HELPERCALLCHK(Op_WasmMemoryTraceWrite, Js::WebAssemblyMemory::TraceMemWrite, AttrCanNotBeReentrant)
 #endif
@@ -1754,6 +1754,12 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
         case Js::OpCode::GrowWasmMemory:
             instrPrev = this->LowerGrowWasmMemory(instr);
             break;
+        case Js::OpCode::WasmMemoryCopy:
+            instrPrev = this->LowerWasmBulkMemory(instr, IR::HelperOp_WasmMemoryCopy);
+            break;
+        case Js::OpCode::WasmMemoryFill:
+            instrPrev = this->LowerWasmBulkMemory(instr, IR::HelperOp_WasmMemoryFill);
+            break;
 #endif
         case Js::OpCode::Ld_I4:
             LowererMD::ChangeToAssign(instr);
@@ -8653,6 +8659,30 @@ Lowerer::LowerGrowWasmMemory(IR::Instr* instr)
 
     return instrPrev;
 }
+
+IR::Instr *
+Lowerer::LowerWasmBulkMemory(IR::Instr* instr, IR::JnHelperMethod helperMethod)
+{
+    // src2 is the chain of ExtendArg_A for (length, source or value, destination), the helper arguments are loaded last to first
+    IR::Instr * instrPrev = nullptr;
+    IR::Opnd * opndLink = instr->UnlinkSrc2();
+    while (opndLink)
+    {
+        IR::Instr * instrDef = opndLink->AsRegOpnd()->m_sym->m_instrDef;
+        Assert(instrDef && instrDef->m_opcode == Js::OpCode::ExtendArg_A);
+        IR::Instr * instrArg = m_lowererMD.LoadHelperArgument(instr, instrDef->GetSrc1());
+        if (!instrPrev)
+        {
+            instrPrev = instrArg;
+        }
+        opndLink = instrDef->GetSrc2();
+    }
+
+    m_lowererMD.LoadHelperArgument(instr, instr->UnlinkSrc1());
+    m_lowererMD.ChangeToHelperCall(instr, helperMethod);
+
+    return instrPrev;
+}
 #endif
 
 IR::Instr *
@@ -26709,6 +26739,11 @@ void Lowerer::LowerFunctionEntry(IR::Instr* funcEntry)
     //Don't do a body call increment for loops or asm.js
     if (m_func->IsLoopBody() || m_func->GetJITFunctionBody()->IsAsmJsMode())
     {
+        if (!m_func->IsLoopBody() && m_func->IsSimpleJit())
+        {
+            // WebAssembly baseline code counts its calls down to the full JIT
+            LowerFunctionBodyCallCountChange(m_func->GetFunctionEntryInsertionPoint());
+        }
         return;
     }
 
@@ -267,6 +267,7 @@ class Lowerer
     IR::Instr *     LowerCheckWasmSignature(IR::Instr * instr);
     IR::Instr *     LowerLdWasmFunc(IR::Instr* instr);
     IR::Instr *     LowerGrowWasmMemory(IR::Instr* instr);
+    IR::Instr *     LowerWasmBulkMemory(IR::Instr* instr, IR::JnHelperMethod helperMethod);
 #endif
     IR::Instr *     LowerInitCachedScope(IR::Instr * instr);
     IR::Instr *     LowerBrBReturn(IR::Instr * instr, IR::JnHelperMethod helperMethod, bool isHelper);
@@ -411,6 +411,15 @@ void NativeCodeGenerator::TransitionFromSimpleJit(Js::ScriptFunction *const func
     Assert(function);
 
     Js::FunctionBody *const functionBody = function->GetFunctionBody();
+#ifdef ASMJS_PLAT
+    if (functionBody->GetIsAsmjsMode())
+    {
+        // WebAssembly baseline code is hot, schedule the full JIT
+        WAsmJs::TierUpFunction(function);
+        return;
+    }
+#endif
+
     Js::FunctionEntryPointInfo *const defaultEntryPointInfo = functionBody->GetDefaultFunctionEntryPointInfo();
     if(defaultEntryPointInfo == functionBody->GetSimpleJitEntryPointInfo())
     {
@@ -1943,7 +1952,10 @@ NativeCodeGenerator::Prioritize(JsUtil::Job *const job, const bool forceAddJobTo
     ExecutionMode jitMode;
     if (functionBody->GetIsAsmjsMode())
     {
-        jitMode = ExecutionMode::FullJit;
+        // Until the baseline code has asked for the full JIT, WebAssembly functions get the baseline (simple) JIT
+        jitMode = functionBody->GetIsWasmBaselineJitScheduled() && !functionBody->GetIsAsmJsFullJitScheduled()
+            ? ExecutionMode::SimpleJit
+            : ExecutionMode::FullJit;
         functionBody->SetAsmJsExecutionMode();
     }
     else
@@ -1252,6 +1252,45 @@ double Js::NumberUtilities::StrToDbl(const EncodedChar *psz, const EncodedChar *
         goto LDone;
 #endif //!DBG
     }
+    else if (cchDig <= 19 && lwExp >= -22 && lwExp <= 22)
+    {
+        // A mantissa of up to 19 digits fits in 64 bits, and if it is no more
+        // than 2^53 it converts to a double exactly. That covers most 16 digit
+        // shortest round-trip strings, which would otherwise go through the
+        // big number code below. As above, the scaling by an exact power of
+        // ten is then the only rounding operation.
+        uint64 luMan = 0;
+        for (pch = pchMinDig; pch < pchLimDig; pch++)
+        {
+            switch (*pch)
+            {
+            case '.':
+                break;
+            case '_':
+                Assert(isNumericSeparatorEnabled && hasNumericSeparators);
+                break;
+            default:
+                Assert(Js::NumberUtilities::IsDigit(*pch));
+                luMan = luMan * 10 + (*pch - '0');
+            }
+        }
+
+        if (luMan <= 0x20000000000000ull)
+        {
+            dbl = (double)luMan;
+            if (lwExp > 0)
+                dbl *= g_rgdblTens[lwExp];
+            else if (lwExp < 0)
+                dbl /= g_rgdblTens[-lwExp];
+
+#if DBG
+            canUseLowPrec = true;
+            dblLowPrec = dbl;
+#else //!DBG
+            goto LDone;
+#endif //!DBG
+        }
+    }
 
     lwExp += cchDig;
     if (lwExp >= klwMaxExp10)
@@ -1961,6 +2000,77 @@ static BOOL FDblToRgbFast(double dbl, _Out_writes_to_(kcbMaxRgb, (*ppbLim - prgb
 }
 
 
+/***************************************************************************
+Get mantissa bytes (BCD) for values that are short decimals, such as 0.1,
+12.75 or 3.5e-7, without big number arithmetic. Looks for the smallest k such
+that an integer m < 2^52 read back as m * 10^-k gives dbl. m and 10^k (k <= 22)
+are exact doubles, so the division m / 10^k rounds exactly the way reading the
+string back does. With m < 2^52 at most one integer can round trip for a given
+k, which makes the digits of m the unique shortest representation. Fails for
+everything else, e.g. values needing 17 significant digits.
+***************************************************************************/
+_Success_(return)
+static BOOL FDblToRgbShortDecimal(double dbl, _Out_writes_to_(kcbMaxRgb, (*ppbLim - prgb)) byte *prgb,
+                                  int *pwExp10, byte **ppbLim)
+{
+    // Caller should take care of 0, negative and non-finite values.
+    Assert(Js::NumberUtilities::IsFinite(dbl));
+    Assert(0 < dbl);
+
+    const double dblTwoTo52 = 4503599627370496.0;
+    double dblMan = 0;
+    int k;
+
+    for (k = 1; k <= 22; k++)
+    {
+        double dblScaled = dbl * g_rgdblTens[k];
+        if (dblScaled >= dblTwoTo52)
+            return FALSE;
+
+        // The product is rounded, so the integer we are after may be on
+        // either side of it.
+        double dblFloor = floor(dblScaled);
+        if (dblFloor != 0 && dblFloor / g_rgdblTens[k] == dbl)
+        {
+            dblMan = dblFloor;
+            break;
+        }
+        double dblCeil = dblFloor + 1;
+        if (dblCeil < dblTwoTo52 && dblCeil / g_rgdblTens[k] == dbl)
+        {
+            dblMan = dblCeil;
+            break;
+        }
+    }
+
+    if (dblMan == 0)
+        return FALSE;
+
+    // Convert the integer to digits, most significant first.
+    byte rgbRev[kcchMaxSig];
+    int cb = 0;
+    uint64 luMan = (uint64)dblMan;
+    while (luMan != 0)
+    {
+        Assert(cb < kcchMaxSig);
+        rgbRev[cb++] = (byte)(luMan % 10);
+        luMan /= 10;
+    }
+
+    *pwExp10 = cb - k;
+
+    // Drop trailing zeros.
+    int ibMin = 0;
+    while (rgbRev[ibMin] == 0)
+        ibMin++;
+
+    int ib = 0;
+    for (int ibRev = cb - 1; ibRev >= ibMin; ibRev--)
+        prgb[ib++] = rgbRev[ibRev];
+    *ppbLim = &prgb[ib];
+    return TRUE;
+}
+
 static BOOL FormatDigits(_In_reads_(pbLim - pbSrc) byte *pbSrc, byte *pbLim, int wExp10, _Out_writes_(cchDst) OLECHAR *pchDst, int cchDst)
 {
     AnalysisAssert(pbLim > pbSrc);
@@ -2531,7 +2641,8 @@ BOOL Js::NumberUtilities::FNonZeroFiniteDblToStr(double dbl, __out_ecount(cchDst
         AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
 #endif //DBG
 
-    if (!FDblToRgbFast(dbl, rgb, &wExp10, &pbLim) &&
+    if (!FDblToRgbShortDecimal(dbl, rgb, &wExp10, &pbLim) &&
+        !FDblToRgbFast(dbl, rgb, &wExp10, &pbLim) &&
         !FDblToRgbPrecise(dbl, rgb, &wExp10, &pbLim))
     {
         AssertMsg(FALSE, "Failure in FDblToRgbPrecise");
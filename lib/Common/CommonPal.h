@@ -742,5 +742,6 @@ namespace PlatformAgnostic
 #include "PlatformAgnostic/Arrays.h"
 #include "PlatformAgnostic/SystemInfo.h"
 #include "PlatformAgnostic/Thread.h"
+#include "PlatformAgnostic/Futex.h"
 #include "PlatformAgnostic/AssemblyCommon.h"
 #include "PlatformAgnostic/Debugger.h"
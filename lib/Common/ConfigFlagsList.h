@@ -26,6 +26,7 @@ PHASE(All)
         PHASE(StringTemplateParse)
         PHASE(CreateParserState)
         PHASE(SkipNestedDeferred)
+        PHASE(IncrementalReparse)
         PHASE(CacheScopeInfoNames)
         PHASE(ScanAhead)
         PHASE_DEFAULT_OFF(ParallelParse)
@@ -39,6 +40,7 @@ PHASE(All)
         PHASE(DisableStackFuncOnDeferredEscape)
         PHASE(DelayCapture)
         PHASE(DebuggerScope)
+        PHASE(FunctionBodyFootprint) // Supports -stats
         PHASE(ByteCodeSerialization)
             PHASE(VariableIntEncoding)
         PHASE(NativeCodeSerialization)
@@ -444,6 +446,9 @@ PHASE(All)
 #define DEFAULT_CONFIG_WasmMultiValue       (false)
 #define DEFAULT_CONFIG_WasmSignExtends      (true)
 #define DEFAULT_CONFIG_WasmNontrapping      (true)
+#define DEFAULT_CONFIG_WasmBulkMemory       (false)
+#define DEFAULT_CONFIG_WasmBaselineJit      (false)
+#define DEFAULT_CONFIG_WasmBaselineJitTierUpCount (1000)
 #define DEFAULT_CONFIG_WasmExperimental     (false)
 #define DEFAULT_CONFIG_BgParse              (false)
 #define DEFAULT_CONFIG_BgJitDelayFgBuffer   (0)
@@ -455,6 +460,9 @@ PHASE(All)
 #define DEFAULT_CONFIG_Prejit               (false)
 #define DEFAULT_CONFIG_ParserStateCache     (true)
 #define DEFAULT_CONFIG_CompressParserStateCache (false)
+#define DEFAULT_CONFIG_IncrementalReparse   (false)
+#define DEFAULT_CONFIG_ShareSourceMetadata (true)
+#define DEFAULT_CONFIG_ShareRegexPrograms (true)
 #define DEFAULT_CONFIG_DeferTopLevelTillFirstCall (true)
 #define DEFAULT_CONFIG_DirectCallTelemetryStats (false)
 #define DEFAULT_CONFIG_errorStackTrace      (true)
@@ -479,6 +487,8 @@ PHASE(All)
 #define DEFAULT_CONFIG_ExtendedErrorStackForTestHost (false)
 #define DEFAULT_CONFIG_ForceSplitScope      (false)
 #define DEFAULT_CONFIG_DelayFullJITSmallFunc (0)
+#define DEFAULT_CONFIG_JsBuiltInEagerProfile (true)
+#define DEFAULT_CONFIG_OneByteStrings       (true)
 #define DEFAULT_CONFIG_EnableFatalErrorOnOOM (true)
 #define DEFAULT_CONFIG_RedeferralCap         (3)
 
@@ -595,6 +605,9 @@ PHASE(All)
 #define DEFAULT_CONFIG_RegexBytecodeDebug   (false)
 #define DEFAULT_CONFIG_RegexOptimize        (true)
 #define DEFAULT_CONFIG_DynamicRegexMruListSize (16)
+#define DEFAULT_CONFIG_RegexLinearTierThreshold (16)
+#define DEFAULT_CONFIG_RegexAutomaton       (true)
+#define DEFAULT_CONFIG_RegexVectorScan      (true)
 #define DEFAULT_CONFIG_GoptCleanupThreshold  (25)
 #define DEFAULT_CONFIG_AsmGoptCleanupThreshold  (500)
 #define DEFAULT_CONFIG_OptimizeForManyInstances (false)
@@ -869,6 +882,8 @@ PHASE(All)
 #define TEMP_ENABLE_FLAG_FOR_APPX_BETA_ONLY 1
 
 #define INMEMORY_CACHE_MAX_URL                    (5)             // This is the max number of URLs that the in-memory profile cache can hold.
+#define INMEMORY_CACHE_MAX_SHARED_SOURCES         (1024)          // This is the max number of sources whose parsed metadata a runtime shares between script contexts.
+#define INMEMORY_CACHE_MAX_SHARED_REGEX_PROGRAMS  (512)           // This is the max number of compiled regex programs a runtime shares between script contexts.
 #define INMEMORY_CACHE_MAX_PROFILE_MANAGER        (50)            // This is the max number of dynamic scripts that the in-memory profile cache can have
 
 #ifdef SUPPORT_INTRUSIVE_TESTTRACES
@@ -990,6 +1005,9 @@ FLAGNR(Boolean, WasmThreads           , "Enable WebAssembly threads feature", DE
 FLAGNR(Boolean, WasmMultiValue        , "Use new WebAssembly multi-value", DEFAULT_CONFIG_WasmMultiValue)
 FLAGNR(Boolean, WasmSignExtends       , "Use new WebAssembly sign extension operators", DEFAULT_CONFIG_WasmSignExtends)
 FLAGNR(Boolean, WasmNontrapping, "Enable non-trapping float-to-int conversions in WebAssembly", DEFAULT_CONFIG_WasmNontrapping)
+FLAGNR(Boolean, WasmBulkMemory        , "Enable WebAssembly bulk memory operators memory.copy and memory.fill", DEFAULT_CONFIG_WasmBulkMemory)
+FLAGNR(Boolean, WasmBaselineJit       , "JIT WebAssembly functions without global optimizations on their first call, and fully optimize them once they are hot", DEFAULT_CONFIG_WasmBaselineJit)
+FLAGNR(Number,  WasmBaselineJitTierUpCount, "Number of calls to the baseline JIT code of a WebAssembly function before it is fully optimized", DEFAULT_CONFIG_WasmBaselineJitTierUpCount)
 
 // WebAssembly Experimental Features
 // Master WasmExperimental flag to activate WebAssembly experimental features
@@ -1059,6 +1077,9 @@ FLAGNR(Phases,  DebugBreakOnPhaseBegin, "Break into debugger at the beginning of
 FLAGNR(Boolean, DebugWindow           , "Send console output to debugger window", false)
 FLAGNR(Boolean, ParserStateCache      , "Enable creation of parser state cache", DEFAULT_CONFIG_ParserStateCache)
 FLAGNR(Boolean, CompressParserStateCache, "Enable compression of the parser state cache", DEFAULT_CONFIG_CompressParserStateCache)
+FLAGNR(Boolean, IncrementalReparse    , "Reuse compiled functions from the previous version of a reloaded source when their text is unchanged", DEFAULT_CONFIG_IncrementalReparse)
+FLAGNR(Boolean, ShareSourceMetadata   , "Share the parsed metadata of identical sources between script contexts of the same runtime", DEFAULT_CONFIG_ShareSourceMetadata)
+FLAGNR(Boolean, ShareRegexPrograms    , "Share compiled regex programs between script contexts of the same runtime", DEFAULT_CONFIG_ShareRegexPrograms)
 FLAGNR(Boolean, DeferTopLevelTillFirstCall      , "Enable tracking of deferred top level functions in a script file, until the first function of the script context is parsed.", DEFAULT_CONFIG_DeferTopLevelTillFirstCall)
 FLAGNR(Number,  DeferParse            , "Minimum size of defer-parsed script (non-zero only: use /nodeferparse do disable", 0)
 FLAGNR(Boolean, DirectCallTelemetryStats, "Enables logging stats for direct call telemetry", DEFAULT_CONFIG_DirectCallTelemetryStats)
@@ -1399,6 +1420,8 @@ FLAGR (Number,  ProfilingInterpreter1Limit, "Limit after which to transition to
 
 FLAGNRA(String, ExecutionModeLimits,        Eml,  "Execution mode limits in th form: AutoProfilingInterpreter0.ProfilingInterpreter0.AutoProfilingInterpreter1.SimpleJit.ProfilingInterpreter1 - Example: -ExecutionModeLimits:12.4.0.132.12", _u(""))
 FLAGRA(Boolean, EnforceExecutionModeLimits, Eeml, "Enforces the execution mode limits such that they are never exceeded.", false)
+FLAGNR(Boolean, JsBuiltInEagerProfile , "Profile self-hosted JS built-ins from their first call and skip the full JIT delay heuristics for them", DEFAULT_CONFIG_JsBuiltInEagerProfile)
+FLAGNR(Boolean, OneByteStrings        , "Keep host-created ASCII strings at one byte per character until a UTF-16 buffer is needed", DEFAULT_CONFIG_OneByteStrings)
 
 FLAGNRA(Number, SimpleJitAfter        , Sja, "Number of calls to a function after which to simple-JIT the function", 0)
 FLAGNRA(Number, FullJitAfter          , Fja, "Number of calls to a function after which to full-JIT the function. The function will be profiled for every iteration.", 0)
@@ -1608,6 +1631,9 @@ FLAGR (Boolean, RegexDebugAnnotatedAST, "Display Regex Annotated AST (requires -
 FLAGR (Boolean, RegexBytecodeDebug    , "Display layout of UnifiedRegex bytecode (requires -RegexDebug to view).", DEFAULT_CONFIG_RegexBytecodeDebug)
 FLAGR (Boolean, RegexOptimize         , "Optimize regular expressions in the unified Regex system (default: true)", DEFAULT_CONFIG_RegexOptimize)
 FLAGR (Number,  DynamicRegexMruListSize, "Size of the MRU list for dynamic regexes", DEFAULT_CONFIG_DynamicRegexMruListSize)
+FLAGR (Number,  RegexLinearTierThreshold, "Number of interpreted matches before a regex that cannot backtrack is lowered to the linear tier (0 disables the tier)", DEFAULT_CONFIG_RegexLinearTierThreshold)
+FLAGR (Boolean, RegexAutomaton        , "Match regular expressions prone to catastrophic backtracking with a linear-time automaton when they have no backreferences or lookarounds (default: true)", DEFAULT_CONFIG_RegexAutomaton)
+FLAGR (Boolean, RegexVectorScan       , "Scan for regex match candidates several characters at a time when the processor supports it (default: true)", DEFAULT_CONFIG_RegexVectorScan)
 #endif
 
 FLAGR (Boolean, OptimizeForManyInstances, "Optimize script engine for many instances (low memory footprint per engine, assume low spare CPU cycles) (default: false)", DEFAULT_CONFIG_OptimizeForManyInstances)
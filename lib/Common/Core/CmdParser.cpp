@@ -345,8 +345,8 @@ CmdLineArgsParser::ParseNumberRange(Js::NumberRange *pRange)
 /// CmdLineArgsParser::ParsePhase
 ///
 /// Parses comma separated list of:
-///     phase[:range]
-/// phase is a string defined in Js:PhaseNames.
+///     phase[:range] | phase-
+/// phase is a string defined in Js:PhaseNames. phase- turns the phase off.
 ///
 ///----------------------------------------------------------------------------
 
@@ -385,6 +385,16 @@ CmdLineArgsParser::ParsePhase(Js::Phases *pPhaseList, Js::Phases *oppositePhase)
         }
         ParsePhase(pPhaseList, oppositePhase);
         break;
+    case '-':
+        // phase- turns a phase that was given before off again
+        NextChar();
+        pPhaseList->Disable(phase);
+        if (CurChar() == ',')
+        {
+            NextChar();
+            ParsePhase(pPhaseList, oppositePhase);
+        }
+        break;
     default:
         if (oppositePhase)
         {
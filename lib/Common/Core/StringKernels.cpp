@@ -0,0 +1,304 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "CommonCorePch.h"
+#include "Core/StringKernels.h"
+
+#if defined(_M_IX86) || defined(_M_X64)
+#ifdef _WIN32
+#include <emmintrin.h>
+#endif
+#endif
+
+namespace StringKernels
+{
+    bool IsVectorized()
+    {
+#if defined(_M_IX86) || defined(_M_X64)
+        return AutoSystemInfo::Data.SSE2Available() != FALSE;
+#else
+        return false;
+#endif
+    }
+
+    const char16* FindChar(__in_ecount(end - start) const char16* start, const char16* end, char16 ch)
+    {
+        const char16* current = start;
+#if defined(_M_IX86) || defined(_M_X64)
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            const __m128i target = _mm_set1_epi16((short)ch);
+            while (end - current >= 8)
+            {
+                const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+                const int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(chars, target));
+                if (mask != 0)
+                {
+                    DWORD index;
+                    _BitScanForward(&index, (DWORD)mask);
+                    return current + (index / sizeof(char16));
+                }
+                current += 8;
+            }
+        }
+#endif
+        while (current < end && *current != ch)
+        {
+            current++;
+        }
+        return current;
+    }
+
+    const char16* FindJsonStringSpecialChar(__in_ecount(end - start) const char16* start, const char16* end)
+    {
+        const char16* current = start;
+#if defined(_M_IX86) || defined(_M_X64)
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            const __m128i quote = _mm_set1_epi16(_u('"'));
+            const __m128i backslash = _mm_set1_epi16(_u('\\'));
+            const __m128i firstNonControl = _mm_set1_epi16(0x20);
+            const __m128i zero = _mm_setzero_si128();
+            while (end - current >= 8)
+            {
+                const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+
+                // Saturating (0x20 - ch) is non-zero only for the control characters 0x00 - 0x1F
+                const __m128i isControl = _mm_cmpgt_epi16(_mm_subs_epu16(firstNonControl, chars), zero);
+                const __m128i isSpecial = _mm_or_si128(isControl,
+                    _mm_or_si128(_mm_cmpeq_epi16(chars, quote), _mm_cmpeq_epi16(chars, backslash)));
+
+                const int mask = _mm_movemask_epi8(isSpecial);
+                if (mask != 0)
+                {
+                    DWORD index;
+                    _BitScanForward(&index, (DWORD)mask);
+                    return current + (index / sizeof(char16));
+                }
+                current += 8;
+            }
+        }
+#endif
+        while (current < end)
+        {
+            const char16 ch = *current;
+            if (ch == _u('"') || ch == _u('\\') || ch <= 0x1F)
+            {
+                break;
+            }
+            current++;
+        }
+        return current;
+    }
+
+    const char16* FindAnyChar(__in_ecount(end - start) const char16* start, const char16* end, __in_ecount(numChars) const char16* chars, int numChars)
+    {
+        Assert(numChars >= 1 && numChars <= MaxAnyChars);
+
+        const char16* current = start;
+#if defined(_M_IX86) || defined(_M_X64)
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            __m128i targets[MaxAnyChars];
+            for (int i = 0; i < numChars; i++)
+            {
+                targets[i] = _mm_set1_epi16((short)chars[i]);
+            }
+            while (end - current >= 8)
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+                __m128i matches = _mm_cmpeq_epi16(block, targets[0]);
+                for (int i = 1; i < numChars; i++)
+                {
+                    matches = _mm_or_si128(matches, _mm_cmpeq_epi16(block, targets[i]));
+                }
+                const int mask = _mm_movemask_epi8(matches);
+                if (mask != 0)
+                {
+                    DWORD index;
+                    _BitScanForward(&index, (DWORD)mask);
+                    return current + (index / sizeof(char16));
+                }
+                current += 8;
+            }
+        }
+#endif
+        for (; current < end; current++)
+        {
+            for (int i = 0; i < numChars; i++)
+            {
+                if (*current == chars[i])
+                {
+                    return current;
+                }
+            }
+        }
+        return current;
+    }
+
+    const char16* FindCharInRanges(__in_ecount(end - start) const char16* start, const char16* end, __in_ecount(numRanges * 2) const char16* ranges, int numRanges, bool isNegation)
+    {
+        Assert(numRanges >= 1 && numRanges <= MaxRanges);
+
+        const char16* current = start;
+#if defined(_M_IX86) || defined(_M_X64)
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            // c is in [lower, upper] iff (c - lower) <= (upper - lower) as unsigned 16-bit values, which SSE2 can only
+            // compare through a saturating subtraction: x <= y iff max(x - y, 0) == 0
+            __m128i lowers[MaxRanges];
+            __m128i widths[MaxRanges];
+            for (int i = 0; i < numRanges; i++)
+            {
+                Assert(ranges[i * 2] <= ranges[i * 2 + 1]);
+                lowers[i] = _mm_set1_epi16((short)ranges[i * 2]);
+                widths[i] = _mm_set1_epi16((short)(ranges[i * 2 + 1] - ranges[i * 2]));
+            }
+            const __m128i zero = _mm_setzero_si128();
+            const int negationMask = isNegation ? 0xFFFF : 0;
+            while (end - current >= 8)
+            {
+                const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+                __m128i inRanges = zero;
+                for (int i = 0; i < numRanges; i++)
+                {
+                    const __m128i offsets = _mm_sub_epi16(block, lowers[i]);
+                    inRanges = _mm_or_si128(inRanges, _mm_cmpeq_epi16(_mm_subs_epu16(offsets, widths[i]), zero));
+                }
+                const int mask = _mm_movemask_epi8(inRanges) ^ negationMask;
+                if (mask != 0)
+                {
+                    DWORD index;
+                    _BitScanForward(&index, (DWORD)mask);
+                    return current + (index / sizeof(char16));
+                }
+                current += 8;
+            }
+        }
+#endif
+        for (; current < end; current++)
+        {
+            bool inRanges = false;
+            for (int i = 0; i < numRanges && !inRanges; i++)
+            {
+                inRanges = *current >= ranges[i * 2] && *current <= ranges[i * 2 + 1];
+            }
+            if (inRanges != isNegation)
+            {
+                return current;
+            }
+        }
+        return current;
+    }
+
+    const char16* FindLiteral(__in_ecount(end - start) const char16* start, const char16* end, __in_ecount(length) const char16* literal, charcount_t length)
+    {
+        Assert(length >= 1);
+
+        if (end - start < (ptrdiff_t)length)
+        {
+            return end;
+        }
+
+        // Last position the literal can start at, plus one
+        const char16* const lastStart = end - (length - 1);
+        const char16* current = start;
+#if defined(_M_IX86) || defined(_M_X64)
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            // Compare the first and last characters of the literal against 8 candidate positions at once, and only
+            // compare the rest of the literal where both agree
+            const __m128i first = _mm_set1_epi16((short)literal[0]);
+            const __m128i last = _mm_set1_epi16((short)literal[length - 1]);
+            while (lastStart - current >= 8)
+            {
+                const __m128i firstBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current));
+                const __m128i lastBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(current + length - 1));
+                int mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi16(firstBlock, first), _mm_cmpeq_epi16(lastBlock, last)));
+                while (mask != 0)
+                {
+                    DWORD index;
+                    _BitScanForward(&index, (DWORD)mask);
+                    const char16* candidate = current + (index / sizeof(char16));
+                    if (length <= 2 || wmemcmp(candidate + 1, literal + 1, length - 2) == 0)
+                    {
+                        return candidate;
+                    }
+                    // Each character sets two bits of the mask
+                    mask &= ~(3 << index);
+                }
+                current += 8;
+            }
+        }
+#endif
+        for (; current < lastStart; current++)
+        {
+            current = FindChar(current, lastStart, literal[0]);
+            if (current == lastStart)
+            {
+                break;
+            }
+            if (wmemcmp(current + 1, literal + 1, length - 1) == 0)
+            {
+                return current;
+            }
+        }
+        return end;
+    }
+
+    template <bool toUpper>
+    bool ChangeAsciiCase(__out_ecount(length) char16* dest, __in_ecount(length) const char16* source, charcount_t length)
+    {
+        const char16 first = toUpper ? _u('a') : _u('A');
+        const char16 last = toUpper ? _u('z') : _u('Z');
+        const char16 diffBetweenCases = 32;
+
+        charcount_t i = 0;
+#if defined(_M_IX86) || defined(_M_X64)
+        if (AutoSystemInfo::Data.SSE2Available())
+        {
+            const __m128i nonAsciiBits = _mm_set1_epi16((short)0xFF80);
+            const __m128i beforeFirst = _mm_set1_epi16((short)(first - 1));
+            const __m128i afterLast = _mm_set1_epi16((short)(last + 1));
+            const __m128i caseBit = _mm_set1_epi16((short)diffBetweenCases);
+            const __m128i zero = _mm_setzero_si128();
+            for (; length - i >= 8; i += 8)
+            {
+                const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(chars, nonAsciiBits), zero)) != 0xFFFF)
+                {
+                    return false;
+                }
+
+                // All lanes are ASCII here, so signed 16-bit compares are safe
+                const __m128i isLetter = _mm_and_si128(_mm_cmpgt_epi16(chars, beforeFirst), _mm_cmplt_epi16(chars, afterLast));
+                const __m128i delta = _mm_and_si128(isLetter, caseBit);
+                const __m128i converted = toUpper ? _mm_sub_epi16(chars, delta) : _mm_add_epi16(chars, delta);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i), converted);
+            }
+        }
+#endif
+        for (; i < length; i++)
+        {
+            const char16 cur = source[i];
+            if (cur >= 0x80)
+            {
+                return false;
+            }
+            if (cur >= first && cur <= last)
+            {
+                dest[i] = toUpper ? cur - diffBetweenCases : cur + diffBetweenCases;
+            }
+            else
+            {
+                dest[i] = cur;
+            }
+        }
+        return true;
+    }
+
+    template bool ChangeAsciiCase<true>(__out_ecount(length) char16* dest, __in_ecount(length) const char16* source, charcount_t length);
+    template bool ChangeAsciiCase<false>(__out_ecount(length) char16* dest, __in_ecount(length) const char16* source, charcount_t length);
+}
@@ -0,0 +1,40 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Hot char16 loops used by the String built-ins, the JSON scanner and the regex sync instructions. On x86/x64 they process
+// 8 characters at a time with SSE2 when the processor supports it, and fall back to a scalar loop elsewhere.
+namespace StringKernels
+{
+    static const int MaxAnyChars = 8;
+    static const int MaxRanges = 4;
+
+    // True if the kernels use vector instructions on this processor
+    bool IsVectorized();
+
+    // Returns the first occurrence of ch in [start, end), or end if there is none
+    const char16* FindChar(__in_ecount(end - start) const char16* start, const char16* end, char16 ch);
+
+    // Returns the first character in [start, end) that needs special handling inside a JSON string
+    // ('"', '\\' or a control character), or end if there is none
+    const char16* FindJsonStringSpecialChar(__in_ecount(end - start) const char16* start, const char16* end);
+
+    // Returns the first occurrence of any of chars[0..numChars - 1] in [start, end), or end if there is none.
+    // numChars must be between 1 and MaxAnyChars.
+    const char16* FindAnyChar(__in_ecount(end - start) const char16* start, const char16* end, __in_ecount(numChars) const char16* chars, int numChars);
+
+    // Returns the first character in [start, end) that is in the union of the inclusive ranges
+    // ranges[2 * i]..ranges[2 * i + 1], or not in it if isNegation, or end if there is none.
+    // numRanges must be between 1 and MaxRanges.
+    const char16* FindCharInRanges(__in_ecount(end - start) const char16* start, const char16* end, __in_ecount(numRanges * 2) const char16* ranges, int numRanges, bool isNegation);
+
+    // Returns the first occurrence of literal in [start, end), or end if there is none. length must be at least 1.
+    const char16* FindLiteral(__in_ecount(end - start) const char16* start, const char16* end, __in_ecount(length) const char16* literal, charcount_t length);
+
+    // Copies length characters from source to dest, mapping ASCII letters to upper or lower case.
+    // Returns false as soon as a non-ASCII character is seen, in which case dest is only partially written.
+    template <bool toUpper>
+    bool ChangeAsciiCase(__out_ecount(length) char16* dest, __in_ecount(length) const char16* source, charcount_t length);
+}
@@ -0,0 +1,22 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#ifdef __linux__
+namespace PlatformAgnostic
+{
+    // Blocking on a 32-bit word of memory shared between the threads of the process
+    class Futex
+    {
+    public:
+        // Blocks until the word no longer holds expected, or until timeout (in milliseconds, INFINITE for none) has
+        // passed. Returns false if the word still holds expected when this returns.
+        static bool Wait(volatile uint32 *address, uint32 expected, uint32 timeout);
+
+        // Wakes up to count threads blocked in Wait on the word, after it has been changed
+        static void Wake(volatile uint32 *address, uint32 count);
+    };
+} // namespace PlatformAgnostic
+#endif
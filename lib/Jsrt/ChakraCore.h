@@ -1992,6 +1992,163 @@ JsGetEmbedderData(_In_ JsValueRef instance, _Out_ JsValueRef* embedderData);
 CHAKRA_API
 JsSetEmbedderData(_In_ JsValueRef instance, _In_ JsValueRef embedderData);
 
+/// <summary>
+///     A callback that receives the output of <c>JsJsonStringifyUtf8</c> one chunk at a time.
+/// </summary>
+/// <remarks>
+///     The chunk is only valid for the duration of the call. The callback must not call back
+///     into any JSRT API.
+/// </remarks>
+/// <param name="chunk">The next piece of the UTF-8 encoded JSON text.</param>
+/// <param name="length">The length of the chunk in bytes.</param>
+/// <param name="callbackState">The state passed to <c>JsJsonStringifyUtf8</c>.</param>
+typedef void (CHAKRA_CALLBACK *JsJsonStringifyChunkCallback)(_In_reads_(length) const char *chunk, _In_ size_t length, _In_opt_ void *callbackState);
+
+/// <summary>
+///     Serializes a value as <c>JSON.stringify</c> would and streams the result to the host
+///     as UTF-8 chunks, without creating the result string.
+/// </summary>
+/// <remarks>
+///     Requires an active script context. Chunks never split a UTF-8 sequence, and lone
+///     surrogates are written as U+FFFD.
+/// </remarks>
+/// <param name="value">The value to serialize.</param>
+/// <param name="replacer">The replacer function or property list. This parameter can be null.</param>
+/// <param name="space">The indentation string or count. This parameter can be null.</param>
+/// <param name="chunkCallback">The callback that receives the output.</param>
+/// <param name="callbackState">State passed back to the callback. This parameter can be null.</param>
+/// <param name="isUndefined">
+///     Set to true if the value has no JSON representation, in which case the callback is not invoked.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsJsonStringifyUtf8(
+    _In_ JsValueRef value,
+    _In_opt_ JsValueRef replacer,
+    _In_opt_ JsValueRef space,
+    _In_ JsJsonStringifyChunkCallback chunkCallback,
+    _In_opt_ void *callbackState,
+    _Out_ bool *isUndefined);
+
+/// <summary>
+///     A reference to the bytes of a WebAssembly module that the host is still receiving.
+/// </summary>
+typedef void* JsWebAssemblyModuleStream;
+
+/// <summary>
+///     Starts receiving the bytes of a WebAssembly module incrementally, for instance as they
+///     arrive from the network.
+/// </summary>
+/// <remarks>
+///     Requires an active script context. The stream is kept alive until it is finished, so every
+///     stream must eventually be passed to <c>JsWebAssemblyModuleStreamFinish</c>, even after an
+///     error.
+/// </remarks>
+/// <param name="expectedLength">
+///     The total length of the module in bytes, if known, or 0. It is only used to size the buffer.
+/// </param>
+/// <param name="stream">The new stream.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsCreateWebAssemblyModuleStream(
+    _In_ unsigned int expectedLength,
+    _Out_ JsWebAssemblyModuleStream *stream);
+
+/// <summary>
+///     Adds the next bytes of a WebAssembly module to a stream.
+/// </summary>
+/// <remarks>
+///     Requires an active script context. The bytes are copied, so the buffer can be reused as soon
+///     as the call returns. The module header and the size of each section are checked as they
+///     arrive: if they cannot be part of a valid module, a <c>WebAssembly.CompileError</c> is set
+///     as the exception and the stream only accepts being finished.
+/// </remarks>
+/// <param name="stream">The stream.</param>
+/// <param name="bytes">The next bytes of the module.</param>
+/// <param name="length">The number of bytes.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsWebAssemblyModuleStreamAppend(
+    _In_ JsWebAssemblyModuleStream stream,
+    _In_reads_bytes_(length) const BYTE *bytes,
+    _In_ unsigned int length);
+
+/// <summary>
+///     Ends a stream and creates a <c>WebAssembly.Module</c> from the bytes it received.
+/// </summary>
+/// <remarks>
+///     Requires an active script context. The stream is released and must not be used again,
+///     whether or not the module could be created. Finishing the same stream twice is not supported.
+/// </remarks>
+/// <param name="stream">The stream.</param>
+/// <param name="module">
+///     The new module, or <c>JS_INVALID_REFERENCE</c> if the stream failed or no module should be
+///     created. This parameter can be null to only release the stream.
+/// </param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsWebAssemblyModuleStreamFinish(
+    _In_ JsWebAssemblyModuleStream stream,
+    _Out_opt_ JsValueRef *module);
+
+/// <summary>
+///     Serializes a compiled <c>WebAssembly.Module</c> so that later runs can skip compiling it.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context. The result holds the module binary and the byte code of
+///     its functions; functions that have not been called yet are compiled first. Native code is not
+///     included and is generated again as the deserialized functions warm up.
+///     </para>
+///     <para>
+///     The result is only valid for the same build and configuration of the engine. A host would
+///     typically store it keyed by a hash of the module binary.
+///     </para>
+/// </remarks>
+/// <param name="module">The <c>WebAssembly.Module</c> to serialize.</param>
+/// <param name="buffer">An <c>ArrayBuffer</c> holding the serialized module.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsSerializeWebAssemblyModule(
+    _In_ JsValueRef module,
+    _Out_ JsValueRef *buffer);
+
+/// <summary>
+///     Creates a <c>WebAssembly.Module</c> from the output of <c>JsSerializeWebAssemblyModule</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Requires an active script context. The module sections are decoded again, but the functions
+///     are neither decoded nor validated: their byte code is taken from the buffer.
+///     </para>
+///     <para>
+///     The buffer is checked against the version and configuration of the engine and against
+///     accidental corruption, but its contents are trusted in the same way as those of
+///     <c>JsRunSerialized</c>. If the check fails, the host should compile the module binary instead.
+///     </para>
+/// </remarks>
+/// <param name="buffer">An <c>ArrayBuffer</c> returned by <c>JsSerializeWebAssemblyModule</c>.</param>
+/// <param name="module">The new module.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorBadSerializedScript</c> if
+///     the buffer was produced by a different build or configuration of the engine or is corrupted,
+///     a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsDeserializeWebAssemblyModule(
+    _In_ JsValueRef buffer,
+    _Out_ JsValueRef *module);
+
 #ifdef _WIN32
 #include "ChakraCoreWindows.h"
 #endif // _WIN32
@@ -17,6 +17,12 @@
 #include "Base/ThreadContextTlsEntry.h"
 #include "Library/JavascriptPromise.h"
 #include "Codex/Utf8Helper.h"
+#include "Library/LazyJSONString.h"
+#include "Library/JSONStringBuilder.h"
+#include "Library/JSONStringifier.h"
+#include "Library/OneByteString.h"
+#include "Language/WebAssemblySource.h"
+#include "ByteCode/ByteCodeSerializer.h"
 
 CHAKRA_API
 JsInitializeModuleRecord(
@@ -882,8 +888,18 @@ CHAKRA_API JsCreateString(
 
     return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
 
-        Js::JavascriptString *stringValue = Js::LiteralStringWithPropertyStringPtr::
-            NewFromCString(content, (CharCount)length, scriptContext->GetLibrary());
+        // ASCII text is the same in UTF-8 and Latin-1, so it can be kept at one byte per character.
+        // Short strings are left alone as they are the likely property names.
+        Js::JavascriptString *stringValue;
+        if (CONFIG_FLAG(OneByteStrings) && length >= Js::OneByteString::MinLength && Js::OneByteString::IsAscii(content, length))
+        {
+            stringValue = Js::OneByteString::New(content, (CharCount)length, true /* isAscii */, scriptContext);
+        }
+        else
+        {
+            stringValue = Js::LiteralStringWithPropertyStringPtr::
+                NewFromCString(content, (CharCount)length, scriptContext->GetLibrary());
+        }
 
         PERFORM_JSRT_TTD_RECORD_ACTION(scriptContext, RecordJsRTCreateString, stringValue->GetSz(), stringValue->GetLength());
 
@@ -1551,3 +1567,269 @@ JsGetArrayBufferFreeFunction(
         return JsNoError;
       });
 }
+
+// Transcodes JSON text to UTF-8 one chunk at a time and hands it to the host
+class JsrtJsonUtf8Sink : public Js::JSONStringSink
+{
+public:
+    static const charcount_t ChunkLength = 1024;
+
+    JsrtJsonUtf8Sink(JsJsonStringifyChunkCallback callback, void* callbackState) :
+        callback(callback), callbackState(callbackState)
+    {
+    }
+
+    void Write(_In_reads_(length) const char16* buffer, charcount_t length) override
+    {
+        while (length > 0)
+        {
+            charcount_t count = min(length, ChunkLength);
+            // Keep surrogate pairs within one chunk so they encode as a single code point
+            if (count < length && count > 1 && utf8::IsHighSurrogateChar(buffer[count - 1]))
+            {
+                --count;
+            }
+
+            const size_t byteCount = utf8::EncodeInto<utf8::Utf8EncodingKind::TrueUtf8>(
+                this->utf8Buffer, sizeof(this->utf8Buffer), buffer, count);
+            this->callback(reinterpret_cast<const char*>(this->utf8Buffer), byteCount, this->callbackState);
+
+            buffer += count;
+            length -= count;
+        }
+    }
+
+private:
+    JsJsonStringifyChunkCallback callback;
+    void* callbackState;
+    utf8char_t utf8Buffer[ChunkLength * 3];
+};
+
+CHAKRA_API
+JsJsonStringifyUtf8(
+    _In_ JsValueRef value,
+    _In_opt_ JsValueRef replacer,
+    _In_opt_ JsValueRef space,
+    _In_ JsJsonStringifyChunkCallback chunkCallback,
+    _In_opt_ void *callbackState,
+    _Out_ bool *isUndefined)
+{
+    VALIDATE_JSREF(value);
+    PARAM_NOT_NULL(chunkCallback);
+    PARAM_NOT_NULL(isUndefined);
+    *isUndefined = false;
+
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+        if (replacer != JS_INVALID_REFERENCE)
+        {
+            VALIDATE_INCOMING_REFERENCE(replacer, scriptContext);
+        }
+        if (space != JS_INVALID_REFERENCE)
+        {
+            VALIDATE_INCOMING_REFERENCE(space, scriptContext);
+        }
+
+        Js::LazyJSONString* json = Js::JSONStringifier::Stringify(scriptContext, value, replacer, space);
+        if (json == nullptr)
+        {
+            *isUndefined = true;
+            return JsNoError;
+        }
+
+        // The builder and the sink each hold one chunk, so the working set stays bounded
+        // no matter how large the serialized text is
+        JsrtJsonUtf8Sink sink(chunkCallback, callbackState);
+        char16 buffer[JsrtJsonUtf8Sink::ChunkLength];
+        json->WriteTo(&sink, buffer, _countof(buffer));
+
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsCreateWebAssemblyModuleStream(
+    _In_ unsigned int expectedLength,
+    _Out_ JsWebAssemblyModuleStream *stream)
+{
+#ifdef ENABLE_WASM
+    PARAM_NOT_NULL(stream);
+    *stream = nullptr;
+
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        if (!CONFIG_FLAG(Wasm) || !PHASE_ENABLED1(WasmPhase))
+        {
+            return JsErrorNotImplemented;
+        }
+
+        Js::WebAssemblySourceStream* sourceStream = Js::WebAssemblySourceStream::New(expectedLength, scriptContext);
+        // The host holds the only reference until the stream is finished
+        scriptContext->GetRecycler()->RootAddRef(sourceStream);
+        *stream = sourceStream;
+        return JsNoError;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
+CHAKRA_API
+JsWebAssemblyModuleStreamAppend(
+    _In_ JsWebAssemblyModuleStream stream,
+    _In_reads_bytes_(length) const BYTE *bytes,
+    _In_ unsigned int length)
+{
+#ifdef ENABLE_WASM
+    PARAM_NOT_NULL(stream);
+    if (length != 0)
+    {
+        PARAM_NOT_NULL(bytes);
+    }
+
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        Js::WebAssemblySourceStream* sourceStream = static_cast<Js::WebAssemblySourceStream*>(stream);
+        if (sourceStream->IsFailed())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        sourceStream->Append(bytes, length, scriptContext);
+        return JsNoError;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
+CHAKRA_API
+JsWebAssemblyModuleStreamFinish(
+    _In_ JsWebAssemblyModuleStream stream,
+    _Out_opt_ JsValueRef *module)
+{
+#ifdef ENABLE_WASM
+    PARAM_NOT_NULL(stream);
+    if (module != nullptr)
+    {
+        *module = JS_INVALID_REFERENCE;
+    }
+
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+
+        Js::WebAssemblySourceStream* sourceStream = static_cast<Js::WebAssemblySourceStream*>(stream);
+
+        // Read everything needed from the stream, then release it before anything can throw. The buffer stays alive
+        // for as long as it is referenced from the stack and, once the module is created, from the module. After this
+        // the stream may be collected at any time, so it is not touched again.
+        bool failed = sourceStream->IsFailed();
+        bool atModuleEnd = sourceStream->IsAtModuleEnd();
+        BYTE* buffer = sourceStream->GetBuffer();
+        uint length = sourceStream->GetLength();
+        scriptContext->GetRecycler()->RootRelease(sourceStream);
+        sourceStream = nullptr;
+
+        if (failed || module == nullptr)
+        {
+            return JsNoError;
+        }
+
+        if (!atModuleEnd)
+        {
+            Js::JavascriptError::ThrowWebAssemblyCompileErrorVar(scriptContext, WASMERR_WasmCompileError, _u("Unexpected end of module"));
+        }
+
+        Js::WebAssemblySource src(buffer, length, true, scriptContext);
+        *module = Js::WebAssemblyModule::CreateModule(scriptContext, &src);
+        return JsNoError;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
+CHAKRA_API
+JsSerializeWebAssemblyModule(
+    _In_ JsValueRef module,
+    _Out_ JsValueRef *buffer)
+{
+#ifdef ENABLE_WASM
+    PARAM_NOT_NULL(buffer);
+    *buffer = JS_INVALID_REFERENCE;
+
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+        VALIDATE_INCOMING_REFERENCE(module, scriptContext);
+
+        if (!Js::VarIs<Js::WebAssemblyModule>(module))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        byte* serialized = nullptr;
+        DWORD serializedLength = 0;
+        JsErrorCode errorCode = JsNoError;
+        BEGIN_TEMP_ALLOCATOR(tempAllocator, scriptContext, _u("ByteCodeSerializer"));
+        HRESULT hr = Js::ByteCodeSerializer::SerializeWasmModule(scriptContext, tempAllocator,
+            Js::VarTo<Js::WebAssemblyModule>(module), &serialized, &serializedLength);
+        if (FAILED(hr))
+        {
+            errorCode = JsErrorOutOfMemory;
+        }
+        else
+        {
+            Js::ArrayBuffer* arrayBuffer = scriptContext->GetLibrary()->CreateArrayBuffer(serializedLength);
+            js_memcpy_s(arrayBuffer->GetBuffer(), serializedLength, serialized, serializedLength);
+            *buffer = arrayBuffer;
+        }
+        END_TEMP_ALLOCATOR(tempAllocator, scriptContext);
+        return errorCode;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
+
+CHAKRA_API
+JsDeserializeWebAssemblyModule(
+    _In_ JsValueRef buffer,
+    _Out_ JsValueRef *module)
+{
+#ifdef ENABLE_WASM
+    PARAM_NOT_NULL(module);
+    *module = JS_INVALID_REFERENCE;
+
+    return ContextAPIWrapper<true>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        PERFORM_JSRT_TTD_RECORD_ACTION_NOT_IMPLEMENTED(scriptContext);
+        VALIDATE_INCOMING_REFERENCE(buffer, scriptContext);
+
+        if (!CONFIG_FLAG(Wasm) || !PHASE_ENABLED1(WasmPhase))
+        {
+            return JsErrorNotImplemented;
+        }
+        if (!Js::VarIs<Js::ArrayBuffer>(buffer))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::ArrayBuffer* arrayBuffer = Js::VarTo<Js::ArrayBuffer>(buffer);
+        Js::WebAssemblyModule* webAssemblyModule = nullptr;
+        HRESULT hr = Js::ByteCodeSerializer::DeserializeWasmModule(scriptContext,
+            arrayBuffer->GetBuffer(), arrayBuffer->GetByteLength(), &webAssemblyModule);
+        if (FAILED(hr))
+        {
+            return JsErrorBadSerializedScript;
+        }
+
+        *module = webAssemblyModule;
+        return JsNoError;
+    });
+#else
+    return JsErrorNotImplemented;
+#endif
+}
@@ -14,6 +14,7 @@
 #include "Library/DataView.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Codex/Utf8Helper.h"
+#include "Library/OneByteString.h"
 
 // Parser Includes
 #include "cmperr.h"     // For ERRnoMemory
@@ -4933,6 +4934,23 @@ CHAKRA_API JsCopyString(
     PARAM_NOT_NULL(value);
     VALIDATE_JSREF(value);
 
+    // ASCII content that hasn't been widened yet is already UTF-8
+    Js::OneByteString* oneByteString = Js::JavascriptOperators::TryFromVar<Js::OneByteString>(value);
+    if (oneByteString != nullptr && oneByteString->IsAsciiContent() && oneByteString->GetOneByteContent() != nullptr)
+    {
+        size_t count = oneByteString->GetLength();
+        if (buffer)
+        {
+            count = min(count, bufferSize);
+            memmove(buffer, oneByteString->GetOneByteContent(), count);
+        }
+        if (length)
+        {
+            *length = count;
+        }
+        return JsNoError;
+    }
+
     const char16* str = nullptr;
     size_t strLength = 0;
     JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
@@ -5228,6 +5246,34 @@ CHAKRA_API JsCopyStringOneByte(
 {
     PARAM_NOT_NULL(value);
     VALIDATE_JSREF(value);
+
+    // Content that hasn't been widened yet can be copied out as is
+    Js::OneByteString* oneByteString = Js::JavascriptOperators::TryFromVar<Js::OneByteString>(value);
+    if (oneByteString != nullptr && oneByteString->GetOneByteContent() != nullptr)
+    {
+        if (written)
+        {
+            *written = 0;
+        }
+
+        const size_t strLength = oneByteString->GetLength();
+        if (start < 0 || (size_t)start > strLength)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        const size_t count = min(static_cast<size_t>(length), strLength - start);
+        if (buffer)
+        {
+            memmove(buffer, oneByteString->GetOneByteContent() + start, count);
+        }
+        if (written)
+        {
+            *written = count;
+        }
+        return JsNoError;
+    }
+
     return WriteStringCopy(value, start, length, written,
         [buffer](const char16* src, size_t count, size_t *needed)
     {
@@ -13,6 +13,7 @@
 #include "DebugWriter.h"
 #include "RegexStats.h"
 #include "StandardChars.h"
+#include "RegexAutomaton.h"
 #include "OctoquadIdentifier.h"
 #include "RegexCompileTime.h"
 #include "RegexParser.h"
@@ -0,0 +1,801 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "ParserPch.h"
+
+namespace UnifiedRegex
+{
+    // ----------------------------------------------------------------------
+    // AutomatonBuilder
+    // ----------------------------------------------------------------------
+
+    // Instructions are emitted twice: first only to count them (and to give up early if there are too many), then
+    // into an array of the right size. Labels are the same in both passes.
+    class AutomatonBuilder : private Chars<char16>
+    {
+    private:
+        Js::ScriptContext* scriptContext;
+        ArenaAllocator* rtAllocator;
+        const Program* program;
+        const Char* litbuf;
+        AutomatonInst* insts; // null while counting
+        uint numInsts;
+        uint closureStackSize;
+        AutomatonInst dummyInst;
+
+        static const uint NoLabel = UINT_MAX;
+
+        AutomatonInst* InstAt(uint pc)
+        {
+            if (insts == nullptr)
+            {
+                return &dummyInst;
+            }
+            Assert(pc < numInsts);
+            return insts + pc;
+        }
+
+        AutomatonInst* Emit(AutomatonInst::Kind kind)
+        {
+            numInsts++;
+            AutomatonInst* inst = InstAt(numInsts - 1);
+            *inst = AutomatonInst(kind);
+            switch (kind)
+            {
+            case AutomatonInst::Kind::Split:
+            case AutomatonInst::Kind::Save:
+                // Each may push one entry onto the closure stack
+                closureStackSize++;
+                break;
+            default:
+                break;
+            }
+            return inst;
+        }
+
+        inline bool IsTooLarge() const
+        {
+            return numInsts > Automaton::MaxInsts;
+        }
+
+        void EmitChar(const Char* cs, bool isEquivClass)
+        {
+            AutomatonInst* inst = Emit(AutomatonInst::Kind::MatchChar);
+            inst->cs[0] = cs[0];
+            inst->numChars = 1;
+            if (isEquivClass)
+            {
+                for (int i = 1; i < CaseInsensitive::EquivClassSize; i++)
+                {
+                    uint j = 0;
+                    while (j < inst->numChars && inst->cs[j] != cs[i])
+                    {
+                        j++;
+                    }
+                    if (j == inst->numChars)
+                    {
+                        inst->cs[inst->numChars++] = cs[i];
+                    }
+                }
+            }
+        }
+
+        void EmitSave(uint slot)
+        {
+            Emit(AutomatonInst::Kind::Save)->slot = slot;
+        }
+
+        void PatchSplit(uint splitPc, uint bodyPc, uint exitPc, bool isGreedy)
+        {
+            AutomatonInst* split = InstAt(splitPc);
+            split->target = isGreedy ? bodyPc : exitPc;
+            split->alternative = isGreedy ? exitPc : bodyPc;
+        }
+
+        void EmitAlt(AltNode* alt);
+        void EmitLoop(LoopNode* loop);
+        void EmitIteration(Node* body, int minGroupId, int maxGroupId);
+        void EmitNode(Node* node);
+
+        void GroupRange(Node* node, int& minGroupId, int& maxGroupId);
+
+    public:
+        AutomatonBuilder(Js::ScriptContext* scriptContext, ArenaAllocator* rtAllocator, const Program* program, const Char* litbuf)
+            : scriptContext(scriptContext)
+            , rtAllocator(rtAllocator)
+            , program(program)
+            , litbuf(litbuf)
+            , insts(nullptr)
+            , numInsts(0)
+            , closureStackSize(0)
+        {
+        }
+
+        bool IsSupported(Node* node);
+        bool IsProneToBacktracking(Node* node);
+        Automaton* Build(Node* root);
+    };
+
+    bool AutomatonBuilder::IsSupported(Node* node)
+    {
+        PROBE_STACK_NO_DISPOSE(scriptContext, Js::Constants::MinStackRegex);
+
+        switch (node->tag)
+        {
+        case Node::Empty:
+        case Node::BOL:
+        case Node::EOL:
+        case Node::WordBoundary:
+        case Node::MatchLiteral:
+        case Node::MatchChar:
+        case Node::MatchSet:
+            return true;
+
+        case Node::Concat:
+            for (ConcatNode* curr = (ConcatNode*)node; curr != nullptr; curr = curr->tail)
+            {
+                if (!IsSupported(curr->head))
+                {
+                    return false;
+                }
+            }
+            return true;
+
+        case Node::Alt:
+            for (AltNode* curr = (AltNode*)node; curr != nullptr; curr = curr->tail)
+            {
+                if (!IsSupported(curr->head))
+                {
+                    return false;
+                }
+            }
+            return true;
+
+        case Node::DefineGroup:
+            return IsSupported(((DefineGroupNode*)node)->body);
+
+        case Node::Loop:
+        {
+            // An iteration matching empty must be rejected, which depends on the path taken rather than the NFA state
+            LoopNode* loop = (LoopNode*)node;
+            return !loop->body->thisConsumes.CouldMatchEmpty() && IsSupported(loop->body);
+        }
+
+        default:
+            // Backreferences and lookarounds
+            return false;
+        }
+    }
+
+    bool AutomatonBuilder::IsProneToBacktracking(Node* node)
+    {
+        PROBE_STACK_NO_DISPOSE(scriptContext, Js::Constants::MinStackRegex);
+
+        switch (node->tag)
+        {
+        case Node::Concat:
+            for (ConcatNode* curr = (ConcatNode*)node; curr != nullptr; curr = curr->tail)
+            {
+                if (IsProneToBacktracking(curr->head))
+                {
+                    return true;
+                }
+            }
+            return false;
+
+        case Node::Alt:
+            for (AltNode* curr = (AltNode*)node; curr != nullptr; curr = curr->tail)
+            {
+                if (IsProneToBacktracking(curr->head))
+                {
+                    return true;
+                }
+            }
+            return false;
+
+        case Node::DefineGroup:
+            return IsProneToBacktracking(((DefineGroupNode*)node)->body);
+
+        case Node::Loop:
+        {
+            // A repeated body which itself needs choicepoints (a nested loop or alternation which could not be compiled
+            // deterministically) can divide the same input between iterations in exponentially many ways
+            LoopNode* loop = (LoopNode*)node;
+            Node* body = loop->body;
+            if (loop->repeats.upper > 1 && (body->features & (Node::HasLoop | Node::HasAlt)) != 0 && !body->isDeterministic)
+            {
+                return true;
+            }
+            return IsProneToBacktracking(body);
+        }
+
+        default:
+            return false;
+        }
+    }
+
+    void AutomatonBuilder::GroupRange(Node* node, int& minGroupId, int& maxGroupId)
+    {
+        PROBE_STACK_NO_DISPOSE(scriptContext, Js::Constants::MinStackRegex);
+
+        if (!node->ContainsDefineGroup())
+        {
+            return;
+        }
+
+        switch (node->tag)
+        {
+        case Node::Concat:
+            for (ConcatNode* curr = (ConcatNode*)node; curr != nullptr; curr = curr->tail)
+            {
+                GroupRange(curr->head, minGroupId, maxGroupId);
+            }
+            break;
+
+        case Node::Alt:
+            for (AltNode* curr = (AltNode*)node; curr != nullptr; curr = curr->tail)
+            {
+                GroupRange(curr->head, minGroupId, maxGroupId);
+            }
+            break;
+
+        case Node::DefineGroup:
+        {
+            DefineGroupNode* group = (DefineGroupNode*)node;
+            minGroupId = min(minGroupId, group->groupId);
+            maxGroupId = max(maxGroupId, group->groupId);
+            GroupRange(group->body, minGroupId, maxGroupId);
+            break;
+        }
+
+        case Node::Loop:
+            GroupRange(((LoopNode*)node)->body, minGroupId, maxGroupId);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    void AutomatonBuilder::EmitAlt(AltNode* alt)
+    {
+        //
+        // Compilation scheme:
+        //
+        //         Split L1, L2
+        //   L1:   <item 1>
+        //         Jump Lexit
+        //   L2:   Split L3, L4
+        //   L3:   <item 2>
+        //         Jump Lexit
+        //   L4:   <last item>
+        //   Lexit:
+        //
+        // Until Lexit is known, the Jumps are chained through their targets.
+        //
+        uint jumpChain = NoLabel;
+        for (AltNode* curr = alt; curr != nullptr && !IsTooLarge(); curr = curr->tail)
+        {
+            if (curr->tail == nullptr)
+            {
+                EmitNode(curr->head);
+                break;
+            }
+
+            const uint splitPc = numInsts;
+            Emit(AutomatonInst::Kind::Split);
+            EmitNode(curr->head);
+            const uint jumpPc = numInsts;
+            Emit(AutomatonInst::Kind::Jump)->target = jumpChain;
+            jumpChain = jumpPc;
+            PatchSplit(splitPc, splitPc + 1, numInsts, true);
+        }
+
+        if (insts != nullptr)
+        {
+            while (jumpChain != NoLabel)
+            {
+                AutomatonInst* jump = InstAt(jumpChain);
+                jumpChain = jump->target;
+                jump->target = numInsts;
+            }
+        }
+    }
+
+    void AutomatonBuilder::EmitIteration(Node* body, int minGroupId, int maxGroupId)
+    {
+        if (minGroupId <= maxGroupId)
+        {
+            // Groups within the body are undefined again at the start of each iteration
+            AutomatonInst* reset = Emit(AutomatonInst::Kind::ResetGroups);
+            reset->minGroupId = minGroupId;
+            reset->maxGroupId = maxGroupId;
+            closureStackSize += (maxGroupId - minGroupId + 1) * 2;
+        }
+        EmitNode(body);
+    }
+
+    void AutomatonBuilder::EmitLoop(LoopNode* loop)
+    {
+        //
+        // Compilation scheme (greedy, Split operands swapped if non-greedy):
+        //
+        //   <body>              lower times
+        //   then, if unbounded:
+        //   Lloop: Split L1, Lexit
+        //   L1:    <body>
+        //          Jump Lloop
+        //   otherwise:
+        //          Split L1, Lexit
+        //   L1:    <body>
+        //          Split L2, Lexit
+        //   L2:    <body>       upper - lower times in all
+        //   Lexit:
+        //
+        // with each <body> preceded by ResetGroups if it defines groups.
+        //
+        int minGroupId = program->numGroups;
+        int maxGroupId = -1;
+        GroupRange(loop->body, minGroupId, maxGroupId);
+
+        for (CharCount i = 0; i < loop->repeats.lower && !IsTooLarge(); i++)
+        {
+            EmitIteration(loop->body, minGroupId, maxGroupId);
+        }
+
+        if (loop->repeats.upper == CharCountFlag)
+        {
+            const uint loopPc = numInsts;
+            Emit(AutomatonInst::Kind::Split);
+            EmitIteration(loop->body, minGroupId, maxGroupId);
+            Emit(AutomatonInst::Kind::Jump)->target = loopPc;
+            PatchSplit(loopPc, loopPc + 1, numInsts, loop->isGreedy);
+        }
+        else
+        {
+            // Until Lexit is known, the Splits are chained through their alternatives
+            uint splitChain = NoLabel;
+            for (CharCount i = loop->repeats.lower; i < loop->repeats.upper && !IsTooLarge(); i++)
+            {
+                const uint splitPc = numInsts;
+                Emit(AutomatonInst::Kind::Split)->alternative = splitChain;
+                splitChain = splitPc;
+                EmitIteration(loop->body, minGroupId, maxGroupId);
+            }
+
+            if (insts != nullptr)
+            {
+                while (splitChain != NoLabel)
+                {
+                    const uint nextSplit = InstAt(splitChain)->alternative;
+                    PatchSplit(splitChain, splitChain + 1, numInsts, loop->isGreedy);
+                    splitChain = nextSplit;
+                }
+            }
+        }
+    }
+
+    void AutomatonBuilder::EmitNode(Node* node)
+    {
+        PROBE_STACK_NO_DISPOSE(scriptContext, Js::Constants::MinStackRegex);
+
+        if (IsTooLarge())
+        {
+            return;
+        }
+
+        const bool isMultiline = (program->flags & MultilineRegexFlag) != 0;
+        switch (node->tag)
+        {
+        case Node::Empty:
+            break;
+
+        case Node::BOL:
+            Emit(isMultiline ? AutomatonInst::Kind::BOLTest : AutomatonInst::Kind::BOITest);
+            break;
+
+        case Node::EOL:
+            Emit(isMultiline ? AutomatonInst::Kind::EOLTest : AutomatonInst::Kind::EOITest);
+            break;
+
+        case Node::WordBoundary:
+            Emit(AutomatonInst::Kind::WordBoundaryTest)->isNegation = ((WordBoundaryNode*)node)->isNegation;
+            break;
+
+        case Node::MatchChar:
+        {
+            MatchCharNode* matchChar = (MatchCharNode*)node;
+            EmitChar(matchChar->cs, matchChar->isEquivClass);
+            break;
+        }
+
+        case Node::MatchLiteral:
+        {
+            MatchLiteralNode* literal = (MatchLiteralNode*)node;
+            const CharCount step = literal->isEquivClass ? CaseInsensitive::EquivClassSize : 1;
+            for (CharCount i = 0; i < literal->length; i++)
+            {
+                EmitChar(litbuf + literal->offset + i * step, literal->isEquivClass);
+            }
+            break;
+        }
+
+        case Node::MatchSet:
+        {
+            MatchSetNode* matchSet = (MatchSetNode*)node;
+            AutomatonInst* inst = Emit(AutomatonInst::Kind::MatchSet);
+            inst->isNegation = matchSet->isNegation;
+            if (insts != nullptr)
+            {
+                inst->set.CloneFrom(rtAllocator, matchSet->set);
+            }
+            break;
+        }
+
+        case Node::Concat:
+            for (ConcatNode* curr = (ConcatNode*)node; curr != nullptr && !IsTooLarge(); curr = curr->tail)
+            {
+                EmitNode(curr->head);
+            }
+            break;
+
+        case Node::Alt:
+            EmitAlt((AltNode*)node);
+            break;
+
+        case Node::DefineGroup:
+        {
+            DefineGroupNode* group = (DefineGroupNode*)node;
+            EmitSave(group->groupId * 2);
+            EmitNode(group->body);
+            EmitSave(group->groupId * 2 + 1);
+            break;
+        }
+
+        case Node::Loop:
+            EmitLoop((LoopNode*)node);
+            break;
+
+        default:
+            Assert(false);
+            __assume(false);
+        }
+    }
+
+    Automaton* AutomatonBuilder::Build(Node* root)
+    {
+        for (int pass = 0; pass < 2; pass++)
+        {
+            if (pass == 1)
+            {
+                insts = RecyclerNewArrayLeaf(scriptContext->GetRecycler(), AutomatonInst, numInsts);
+            }
+            numInsts = 0;
+            // The initial thread
+            closureStackSize = 1;
+
+            EmitSave(0);
+            EmitNode(root);
+            EmitSave(1);
+            Emit(AutomatonInst::Kind::Succ);
+
+            if (IsTooLarge())
+            {
+                Assert(pass == 0);
+                return nullptr;
+            }
+        }
+
+        return RecyclerNew(scriptContext->GetRecycler(), Automaton, insts, numInsts, program->numGroups * 2, closureStackSize);
+    }
+
+    // ----------------------------------------------------------------------
+    // AutomatonThreads
+    // ----------------------------------------------------------------------
+
+    AutomatonThreads* AutomatonThreads::New(Recycler* recycler, const Automaton& automaton)
+    {
+        AutomatonThreads* threads = RecyclerNewStruct(recycler, AutomatonThreads);
+        for (int i = 0; i < 2; i++)
+        {
+            AutomatonThreadList& list = threads->lists[i];
+            list.sparse = RecyclerNewArrayLeafZ(recycler, uint, automaton.numInsts);
+            list.dense = RecyclerNewArrayLeafZ(recycler, uint, automaton.numInsts);
+            list.caps = RecyclerNewArrayLeafZ(recycler, CharCount, automaton.numInsts * automaton.numSlots);
+            list.count = 0;
+        }
+        threads->closureStack = RecyclerNewArrayLeafZ(recycler, AutomatonClosureEntry, automaton.closureStackSize);
+        threads->threadCaps = RecyclerNewArrayLeafZ(recycler, CharCount, automaton.numSlots);
+        threads->startCaps = RecyclerNewArrayLeafZ(recycler, CharCount, automaton.numSlots);
+        for (uint i = 0; i < automaton.numSlots; i++)
+        {
+            threads->startCaps[i] = CharCountFlag;
+        }
+        return threads;
+    }
+
+    // ----------------------------------------------------------------------
+    // Automaton
+    // ----------------------------------------------------------------------
+
+    Automaton::Automaton(AutomatonInst* insts, uint numInsts, uint numSlots, uint closureStackSize)
+        : insts(insts)
+        , numInsts(numInsts)
+        , numSlots(numSlots)
+        , closureStackSize(closureStackSize)
+    {
+    }
+
+    Automaton* Automaton::TryNew(
+        Js::ScriptContext* scriptContext,
+        ArenaAllocator* rtAllocator,
+        const Program* program,
+        const Char* litbuf,
+        Node* root)
+    {
+        AutomatonBuilder builder(scriptContext, rtAllocator, program, litbuf);
+        if (!builder.IsProneToBacktracking(root) || !builder.IsSupported(root))
+        {
+            return nullptr;
+        }
+        return builder.Build(root);
+    }
+
+    void Automaton::FreeBody(ArenaAllocator* rtAllocator)
+    {
+        for (uint pc = 0; pc < numInsts; pc++)
+        {
+            if (insts[pc].kind == AutomatonInst::Kind::MatchSet)
+            {
+                insts[pc].set.FreeBody(rtAllocator);
+            }
+        }
+    }
+
+    // Add the thread at pc, with the given captures, to list, following epsilon transitions in priority order. States
+    // already in the list are held by a thread of higher priority, which the backtracking interpreter would have tried
+    // first and which will reach the same outcome from there, so they are not visited again.
+    void Automaton::AddThread(
+        AutomatonThreads& threads,
+        AutomatonThreadList& list,
+        uint pc,
+        const CharCount* const caps,
+        const Char* const input,
+        const CharCount inputLength,
+        const CharCount inputOffset,
+        StandardChars<Char>* const standardChars) const
+    {
+        CharCount* const threadCaps = threads.threadCaps;
+        js_memcpy_s(threadCaps, numSlots * sizeof(CharCount), caps, numSlots * sizeof(CharCount));
+
+        AutomatonClosureEntry* const stack = threads.closureStack;
+        uint top = 0;
+        stack[top++] = { false, pc, 0 };
+
+        while (top > 0)
+        {
+            const AutomatonClosureEntry entry = stack[--top];
+            if (entry.isRestore)
+            {
+                threadCaps[entry.pcOrSlot] = entry.value;
+                continue;
+            }
+
+            pc = entry.pcOrSlot;
+            while (!list.Contains(pc))
+            {
+                const uint index = list.Add(pc);
+                const AutomatonInst& inst = insts[pc];
+                bool follow = true;
+                switch (inst.kind)
+                {
+                case AutomatonInst::Kind::Jump:
+                    pc = inst.target;
+                    continue;
+
+                case AutomatonInst::Kind::Split:
+                    Assert(top < closureStackSize);
+                    stack[top++] = { false, inst.alternative, 0 };
+                    pc = inst.target;
+                    continue;
+
+                case AutomatonInst::Kind::Save:
+                    Assert(top < closureStackSize);
+                    stack[top++] = { true, inst.slot, threadCaps[inst.slot] };
+                    threadCaps[inst.slot] = inputOffset;
+                    break;
+
+                case AutomatonInst::Kind::ResetGroups:
+                    for (uint slot = inst.minGroupId * 2; slot <= (uint)inst.maxGroupId * 2 + 1; slot++)
+                    {
+                        if (threadCaps[slot] != CharCountFlag)
+                        {
+                            Assert(top < closureStackSize);
+                            stack[top++] = { true, slot, threadCaps[slot] };
+                            threadCaps[slot] = CharCountFlag;
+                        }
+                    }
+                    break;
+
+                case AutomatonInst::Kind::BOITest:
+                    follow = inputOffset == 0;
+                    break;
+
+                case AutomatonInst::Kind::EOITest:
+                    follow = inputOffset == inputLength;
+                    break;
+
+                case AutomatonInst::Kind::BOLTest:
+                    follow = inputOffset == 0 || standardChars->IsNewline(input[inputOffset - 1]);
+                    break;
+
+                case AutomatonInst::Kind::EOLTest:
+                    follow = inputOffset == inputLength || standardChars->IsNewline(input[inputOffset]);
+                    break;
+
+                case AutomatonInst::Kind::WordBoundaryTest:
+                {
+                    const bool prev = inputOffset > 0 && standardChars->IsWord(input[inputOffset - 1]);
+                    const bool curr = inputOffset < inputLength && standardChars->IsWord(input[inputOffset]);
+                    follow = inst.isNegation != (prev != curr);
+                    break;
+                }
+
+                default:
+                    // MatchChar, MatchSet and Succ wait here for the next step
+                    js_memcpy_s(list.caps + index * numSlots, numSlots * sizeof(CharCount), threadCaps, numSlots * sizeof(CharCount));
+                    follow = false;
+                    break;
+                }
+
+                if (!follow)
+                {
+                    break;
+                }
+                pc++;
+            }
+        }
+    }
+
+    bool Automaton::Match(
+        const Char* const input,
+        const CharCount inputLength,
+        const CharCount offset,
+        const bool tryLaterStarts,
+        StandardChars<Char>* const standardChars,
+        AutomatonThreads& threads,
+        GroupInfo* const groupInfos) const
+    {
+        AutomatonThreadList* currList = &threads.lists[0];
+        AutomatonThreadList* nextList = &threads.lists[1];
+        currList->count = 0;
+
+        bool matched = false;
+        CharCount inputOffset = offset;
+        while (true)
+        {
+            if (!matched && (inputOffset == offset || tryLaterStarts))
+            {
+                // A match starting here has lower priority than any starting earlier
+                AddThread(threads, *currList, 0, threads.startCaps, input, inputLength, inputOffset, standardChars);
+            }
+
+            nextList->count = 0;
+            for (uint i = 0; i < currList->count; i++)
+            {
+                const uint pc = currList->dense[i];
+                const AutomatonInst& inst = insts[pc];
+                const CharCount* const caps = currList->caps + i * numSlots;
+                if (inst.kind == AutomatonInst::Kind::Succ)
+                {
+                    // The threads after this one could only produce lower priority matches
+                    matched = true;
+                    for (uint16 groupId = 0; groupId < numSlots / 2; groupId++)
+                    {
+                        const CharCount start = caps[groupId * 2];
+                        const CharCount end = caps[groupId * 2 + 1];
+                        if (start == CharCountFlag || end == CharCountFlag)
+                        {
+                            groupInfos[groupId].Reset();
+                        }
+                        else
+                        {
+                            Assert(end >= start);
+                            groupInfos[groupId].offset = start;
+                            groupInfos[groupId].length = end - start;
+                        }
+                    }
+                    break;
+                }
+
+                if (inputOffset < inputLength && inst.Consumes(input[inputOffset]))
+                {
+                    AddThread(threads, *nextList, pc + 1, caps, input, inputLength, inputOffset + 1, standardChars);
+                }
+            }
+
+            if (inputOffset >= inputLength || (nextList->count == 0 && (matched || !tryLaterStarts)))
+            {
+                break;
+            }
+
+            inputOffset++;
+            AutomatonThreadList* const list = currList;
+            currList = nextList;
+            nextList = list;
+        }
+
+        if (!matched)
+        {
+            groupInfos[0].Reset();
+        }
+        return matched;
+    }
+
+#if ENABLE_REGEX_CONFIG_OPTIONS
+    void Automaton::Print(DebugWriter* w) const
+    {
+        w->PrintEOL(_u("Automaton {"));
+        w->Indent();
+        w->PrintEOL(_u("numSlots: %u"), numSlots);
+        for (uint pc = 0; pc < numInsts; pc++)
+        {
+            const AutomatonInst& inst = insts[pc];
+            w->Print(_u("L%04x: "), pc);
+            switch (inst.kind)
+            {
+            case AutomatonInst::Kind::MatchChar:
+                w->Print(_u("MatchChar("));
+                for (uint i = 0; i < inst.numChars; i++)
+                {
+                    if (i > 0)
+                    {
+                        w->Print(_u(", "));
+                    }
+                    w->PrintQuotedChar(inst.cs[i]);
+                }
+                w->PrintEOL(_u(")"));
+                break;
+            case AutomatonInst::Kind::MatchSet:
+                w->Print(_u("MatchSet(%s"), inst.isNegation ? _u("not ") : _u(""));
+                inst.set.Print(w);
+                w->PrintEOL(_u(")"));
+                break;
+            case AutomatonInst::Kind::Split:
+                w->PrintEOL(_u("Split(L%04x, L%04x)"), inst.target, inst.alternative);
+                break;
+            case AutomatonInst::Kind::Jump:
+                w->PrintEOL(_u("Jump(L%04x)"), inst.target);
+                break;
+            case AutomatonInst::Kind::Save:
+                w->PrintEOL(_u("Save(%u)"), inst.slot);
+                break;
+            case AutomatonInst::Kind::ResetGroups:
+                w->PrintEOL(_u("ResetGroups(%d, %d)"), inst.minGroupId, inst.maxGroupId);
+                break;
+            case AutomatonInst::Kind::BOITest:
+                w->PrintEOL(_u("BOITest"));
+                break;
+            case AutomatonInst::Kind::EOITest:
+                w->PrintEOL(_u("EOITest"));
+                break;
+            case AutomatonInst::Kind::BOLTest:
+                w->PrintEOL(_u("BOLTest"));
+                break;
+            case AutomatonInst::Kind::EOLTest:
+                w->PrintEOL(_u("EOLTest"));
+                break;
+            case AutomatonInst::Kind::WordBoundaryTest:
+                w->PrintEOL(_u("WordBoundaryTest(%s)"), inst.isNegation ? _u("not ") : _u(""));
+                break;
+            case AutomatonInst::Kind::Succ:
+                w->PrintEOL(_u("Succ"));
+                break;
+            }
+        }
+        w->Unindent();
+        w->PrintEOL(_u("}"));
+    }
+#endif
+}
@@ -0,0 +1,195 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// Linear-time matching of patterns prone to catastrophic backtracking.
+//
+// Patterns such as /(a+)+b/ or /(\w+\s?)+$/ make the backtracking interpreter try exponentially many ways of
+// dividing the input between nested loops before it can report a failure. If such a pattern has no backreferences,
+// no lookarounds and no loop whose body could match empty, its AST is additionally compiled to a Thompson NFA which
+// the matcher runs as a Pike VM: all threads advance over the input in lock step, at most one thread occupies each
+// NFA state at each input position, and the threads are kept in the order in which the backtracking interpreter
+// would have tried them. The match and captures are therefore exactly those of the interpreter, but are found in
+// time proportional to the input length times the NFA size.
+//
+#pragma once
+
+namespace UnifiedRegex
+{
+    // FORWARD
+    struct Node;
+    class Automaton;
+
+    // ----------------------------------------------------------------------
+    // AutomatonInst
+    // ----------------------------------------------------------------------
+
+    struct AutomatonInst : private Chars<char16>
+    {
+        enum class Kind : uint8
+        {
+            MatchChar,          // cs[0..numChars - 1] are alternatives for one input character
+            MatchSet,           // set, isNegation
+            Split,              // continue at target, or failing that at alternative
+            Jump,               // target
+            Save,               // store the input offset into capture slot
+            ResetGroups,        // undefine groups minGroupId..maxGroupId
+            BOITest,
+            EOITest,
+            BOLTest,
+            EOLTest,
+            WordBoundaryTest,   // isNegation
+            Succ
+        };
+
+        Kind kind;
+        bool isNegation;
+        uint8 numChars;
+        Char cs[CaseInsensitive::EquivClassSize];
+        uint target;
+        uint alternative;
+        uint slot;
+        int minGroupId;
+        int maxGroupId;
+        // In run-time allocator, owned by the automaton
+        RuntimeCharSet<Char> set;
+
+        inline AutomatonInst(Kind kind = Kind::Succ)
+            : kind(kind), isNegation(false), numChars(0), target(0), alternative(0), slot(0), minGroupId(0), maxGroupId(-1)
+        {
+            cs[0] = cs[1] = cs[2] = cs[3] = 0;
+        }
+
+        // True if this is a MatchChar or MatchSet instruction which accepts c
+        inline bool Consumes(const Char c) const
+        {
+            switch (kind)
+            {
+            case Kind::MatchChar:
+                for (uint i = 0; i < numChars; i++)
+                {
+                    if (cs[i] == c)
+                    {
+                        return true;
+                    }
+                }
+                return false;
+
+            case Kind::MatchSet:
+                return set.Get(c) != isNegation;
+
+            default:
+                return false;
+            }
+        }
+    };
+
+    // ----------------------------------------------------------------------
+    // AutomatonThreads
+    // ----------------------------------------------------------------------
+
+    // The set of NFA states reached at one input position, in priority order, with the captures of the thread in each
+    struct AutomatonThreadList
+    {
+        Field(uint*) sparse;        // state => index into dense, valid only if dense agrees
+        Field(uint*) dense;         // states in priority order
+        Field(CharCount*) caps;     // numSlots captures per entry of dense
+        Field(uint) count;
+
+        inline bool Contains(const uint pc) const
+        {
+            const uint index = sparse[pc];
+            return index < count && dense[index] == pc;
+        }
+
+        inline uint Add(const uint pc)
+        {
+            const uint index = count++;
+            sparse[pc] = index;
+            dense[index] = pc;
+            return index;
+        }
+    };
+
+    struct AutomatonClosureEntry
+    {
+        bool isRestore;
+        uint pcOrSlot;
+        CharCount value;            // isRestore => capture to put back into the slot
+    };
+
+    // Matcher-owned scratch space for running an automaton, allocated on first use
+    struct AutomatonThreads
+    {
+        Field(AutomatonThreadList) lists[2];
+        Field(AutomatonClosureEntry*) closureStack;
+        Field(CharCount*) threadCaps;
+        Field(CharCount*) startCaps;
+
+        static AutomatonThreads* New(Recycler* recycler, const Automaton& automaton);
+    };
+
+    // ----------------------------------------------------------------------
+    // Automaton
+    // ----------------------------------------------------------------------
+
+    class Automaton : private Chars<char16>
+    {
+        friend class AutomatonBuilder;
+        friend struct AutomatonThreads;
+
+    public:
+        // Patterns needing more instructions than this (typically because of large counted repeats) keep
+        // backtracking only
+        static const uint MaxInsts = 1024;
+
+    private:
+        // In recycler, owned by automaton
+        Field(AutomatonInst*) insts;
+        Field(uint) numInsts;
+        // Two capture slots (start and end offset) per group
+        Field(uint) numSlots;
+        // Bound on the depth of the explicit stack used to follow epsilon transitions
+        Field(uint) closureStackSize;
+
+        Automaton(AutomatonInst* insts, uint numInsts, uint numSlots, uint closureStackSize);
+
+        void AddThread(
+            AutomatonThreads& threads,
+            AutomatonThreadList& list,
+            uint pc,
+            const CharCount* const caps,
+            const Char* const input,
+            const CharCount inputLength,
+            const CharCount inputOffset,
+            StandardChars<Char>* const standardChars) const;
+
+    public:
+        // Returns null unless root (annotated and with its literals captured into program) is both prone to
+        // catastrophic backtracking and representable as an automaton
+        static Automaton* TryNew(
+            Js::ScriptContext* scriptContext,
+            ArenaAllocator* rtAllocator,
+            const Program* program,
+            const Char* litbuf,
+            Node* root);
+
+        void FreeBody(ArenaAllocator* rtAllocator);
+
+        // As for the backtracking interpreter: look for the highest priority match starting at offset, or at any
+        // later position if tryLaterStarts, and fill in groupInfos. On failure only group 0 is meaningful.
+        bool Match(
+            const Char* const input,
+            const CharCount inputLength,
+            const CharCount offset,
+            const bool tryLaterStarts,
+            StandardChars<Char>* const standardChars,
+            AutomatonThreads& threads,
+            GroupInfo* const groupInfos) const;
+
+#if ENABLE_REGEX_CONFIG_OPTIONS
+        void Print(DebugWriter* w) const;
+#endif
+    };
+}
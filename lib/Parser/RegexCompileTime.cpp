@@ -94,7 +94,7 @@ namespace UnifiedRegex
             else if (count == 2)
                 EMIT(compiler, SyncToChar2SetAndConsumeInst, entries[0], entries[1]);
             else
-                EMIT(compiler, SyncToSetAndConsumeInst<false>)->set.CloneFrom(compiler.rtAllocator, *firstSet);
+                EMIT(compiler, SyncToSetAndConsumeInst<false>)->CloneFrom(compiler.rtAllocator, *firstSet);
             return 1;
         }
         else
@@ -104,7 +104,7 @@ namespace UnifiedRegex
             else if (count == 2)
                 EMIT(compiler, SyncToChar2SetAndContinueInst, entries[0], entries[1]);
             else
-                EMIT(compiler, SyncToSetAndContinueInst<false>)->set.CloneFrom(compiler.rtAllocator, *firstSet);
+                EMIT(compiler, SyncToSetAndContinueInst<false>)->CloneFrom(compiler.rtAllocator, *firstSet);
             return 0;
         }
     }
@@ -930,6 +930,7 @@ namespace UnifiedRegex
         ScannerMixin* scanner =
             scanners.Add(compiler.GetScriptContext()->GetRecycler(), compiler.GetProgram(), offset, length, isEquivClass);
         scanner->scanner.Setup(compiler.rtAllocator, compiler.program->rep.insts.litbuf + offset, length, isEquivClass ? CaseInsensitive::EquivClassSize : 1);
+        scanners.AddFirstChars(compiler.program->rep.insts.litbuf + offset, isEquivClass);
     }
 
     void MatchLiteralNode::BestSyncronizingNode(Compiler& compiler, Node*& bestNode)
@@ -1412,7 +1413,7 @@ namespace UnifiedRegex
             if (firstSet->IsSingleton())
                 EMIT(compiler, SyncToCharAndConsumeInst, firstSet->Singleton());
             else
-                EMIT(compiler, SyncToSetAndConsumeInst<false>)->set.CloneFrom(compiler.rtAllocator, *firstSet);
+                EMIT(compiler, SyncToSetAndConsumeInst<false>)->CloneFrom(compiler.rtAllocator, *firstSet);
             return 1;
         }
         else
@@ -1429,14 +1430,14 @@ namespace UnifiedRegex
                 else if (count == 2)
                     EMIT(compiler, SyncToChar2SetAndContinueInst, entries[0], entries[1]);
                 else
-                    EMIT(compiler, SyncToSetAndContinueInst<false>)->set.CloneFrom(compiler.rtAllocator, *firstSet);
+                    EMIT(compiler, SyncToSetAndContinueInst<false>)->CloneFrom(compiler.rtAllocator, *firstSet);
             }
             else
             {
                 if (firstSet->IsSingleton())
                     EMIT(compiler, SyncToCharAndBackupInst, firstSet->Singleton(), prevConsumes);
                 else
-                    EMIT(compiler, SyncToSetAndBackupInst<false>, prevConsumes)->set.CloneFrom(compiler.rtAllocator, *firstSet);
+                    EMIT(compiler, SyncToSetAndBackupInst<false>, prevConsumes)->CloneFrom(compiler.rtAllocator, *firstSet);
             }
             return 0;
         }
@@ -1665,16 +1666,15 @@ namespace UnifiedRegex
         //   SyncToSetAnd(Consume|Continue|Backup)
         //
 
-        RuntimeCharSet<Char> *runtimeSet;
         CharCount consumedChars;
         if (isHeadSyncronizingNode)
         {
             // For a head literal there's no need to back up after finding the literal, so use a faster instruction
             Assert(prevConsumes.IsExact(0)); // there should not be any consumes before this node
             if(isNegation)
-                runtimeSet = &EMIT(compiler, SyncToSetAndConsumeInst<true>)->set;
+                EMIT(compiler, SyncToSetAndConsumeInst<true>)->CloneFrom(compiler.rtAllocator, set);
             else
-                runtimeSet = &EMIT(compiler, SyncToSetAndConsumeInst<false>)->set;
+                EMIT(compiler, SyncToSetAndConsumeInst<false>)->CloneFrom(compiler.rtAllocator, set);
             consumedChars = 1;
         }
         else
@@ -1686,17 +1686,16 @@ namespace UnifiedRegex
             if(prevConsumes.IsExact(0))
             {
                 if(isNegation)
-                    runtimeSet = &EMIT(compiler, SyncToSetAndContinueInst<true>)->set;
+                    EMIT(compiler, SyncToSetAndContinueInst<true>)->CloneFrom(compiler.rtAllocator, set);
                 else
-                    runtimeSet = &EMIT(compiler, SyncToSetAndContinueInst<false>)->set;
+                    EMIT(compiler, SyncToSetAndContinueInst<false>)->CloneFrom(compiler.rtAllocator, set);
             }
             else if(isNegation)
-                runtimeSet = &EMIT(compiler, SyncToSetAndBackupInst<true>, prevConsumes)->set;
+                EMIT(compiler, SyncToSetAndBackupInst<true>, prevConsumes)->CloneFrom(compiler.rtAllocator, set);
             else
-                runtimeSet = &EMIT(compiler, SyncToSetAndBackupInst<false>, prevConsumes)->set;
+                EMIT(compiler, SyncToSetAndBackupInst<false>, prevConsumes)->CloneFrom(compiler.rtAllocator, set);
             consumedChars = 0;
         }
-        runtimeSet->CloneFrom(compiler.rtAllocator, set);
         return consumedChars;
     }
 
@@ -4782,6 +4781,12 @@ namespace UnifiedRegex
 
                     compiler.Emit<SuccInst>();
                     compiler.CaptureInsts();
+
+                    if (REGEX_CONFIG_FLAG(RegexAutomaton))
+                    {
+                        // Keep a linear-time automaton alongside the instructions if they could backtrack catastrophically
+                        program->automaton = Automaton::TryNew(scriptContext, rtAllocator, program, program->rep.insts.litbuf, root);
+                    }
                 }
             }
             else
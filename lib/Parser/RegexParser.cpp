@@ -2997,6 +2997,19 @@ namespace UnifiedRegex
             return nullptr;
         }
 
+        ThreadContext* threadContext = this->scriptContext->GetThreadContext();
+        SharedRegexProgram* sharedProgram = threadContext->FindSharedRegexProgram(RegexKey(program->source, program->sourceLen, flags));
+        if (sharedProgram != nullptr)
+        {
+            // Another script context of this runtime has already compiled this regex
+            RegexPattern* sharedPattern = RegexPattern::New(this->scriptContext, sharedProgram->program, true);
+            sharedPattern->sharedProgram = sharedProgram;
+#ifdef PROFILE_EXEC
+            this->scriptContext->ProfileEnd(Js::RegexCompilePhase);
+#endif
+            return sharedPattern;
+        }
+
         RegexPattern* pattern = RegexPattern::New(this->scriptContext, program, true);
 
 #if ENABLE_REGEX_CONFIG_OPTIONS
@@ -3018,6 +3031,14 @@ namespace UnifiedRegex
 #endif
 
         ArenaAllocator* rtAllocator = this->scriptContext->RegexAllocator();
+        ArenaAllocator* sharedAllocator = program->IsShareableAcrossScriptContexts() ? threadContext->GetSharedRegexAllocator() : nullptr;
+        if (sharedAllocator != nullptr)
+        {
+            // Set before compiling so that the pattern never frees the body into the wrong allocator
+            rtAllocator = sharedAllocator;
+            pattern->sharedProgram = SharedRegexProgram::New(this->scriptContext->GetRecycler(), program, sharedAllocator);
+        }
+
         Compiler::Compile
             ( this->scriptContext
               , ctAllocator
@@ -3038,6 +3059,11 @@ namespace UnifiedRegex
             this->scriptContext->GetRegexStatsDatabase()->EndProfile(stats, RegexStats::Compile);
 #endif
 
+        if (sharedAllocator != nullptr)
+        {
+            threadContext->AddSharedRegexProgram(pattern->sharedProgram);
+        }
+
 #ifdef PROFILE_EXEC
         this->scriptContext->ProfileEnd(Js::RegexCompilePhase);
 #endif
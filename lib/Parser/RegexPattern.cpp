@@ -6,8 +6,33 @@
 
 namespace UnifiedRegex
 {
+    SharedRegexProgram::SharedRegexProgram(Program* program, ArenaAllocator* rtAllocator)
+        : program(program), rtAllocator(rtAllocator)
+    {
+    }
+
+    SharedRegexProgram *SharedRegexProgram::New(Recycler *recycler, Program* program, ArenaAllocator* rtAllocator)
+    {
+        return RecyclerNewFinalized(recycler, SharedRegexProgram, program, rtAllocator);
+    }
+
+    void SharedRegexProgram::Finalize(bool isShutdown)
+    {
+        if (isShutdown)
+        {
+            // The shared allocator goes away with the runtime
+            return;
+        }
+
+        program->FreeBody(rtAllocator);
+    }
+
+    void SharedRegexProgram::Dispose(bool isShutdown)
+    {
+    }
+
     RegexPattern::RegexPattern(Js::JavascriptLibrary *const library, Program* program, bool isLiteral)
-        : library(library), isLiteral(isLiteral), isShallowClone(false), testCache(nullptr)
+        : library(library), isLiteral(isLiteral), isShallowClone(false), sharedProgram(nullptr), testCache(nullptr)
     {
         rep.unified.program = program;
         rep.unified.matcher = nullptr;
@@ -56,7 +81,7 @@ namespace UnifiedRegex
         }
 #endif
 
-        if (isShallowClone)
+        if (isShallowClone || sharedProgram != nullptr)
         {
             return;
         }
@@ -141,6 +166,7 @@ namespace UnifiedRegex
         Matcher *matcherClone = rep.unified.matcher ? rep.unified.matcher->CloneToScriptContext(scriptContext, result) : nullptr;
         result->rep.unified.matcher = matcherClone;
         result->isShallowClone = true;
+        result->sharedProgram = sharedProgram;
         return result;
     }
 
@@ -23,6 +23,23 @@ namespace UnifiedRegex
         Field(RecyclerWeakReference<Js::JavascriptString>*) inputArray[];
     };
 
+    // A program compiled into the runtime's shared regex allocator. Every pattern using the program holds on to this, while
+    // the runtime's cache of shared programs only refers to it weakly (see ThreadContext::FindSharedRegexProgram), so the
+    // program body is freed once no script context uses it anymore.
+    struct SharedRegexProgram : FinalizableObject
+    {
+        Field(Program*) program;
+        FieldNoBarrier(ArenaAllocator*) rtAllocator;
+
+        SharedRegexProgram(Program* program, ArenaAllocator* rtAllocator);
+
+        static SharedRegexProgram *New(Recycler *recycler, Program* program, ArenaAllocator* rtAllocator);
+
+        virtual void Finalize(bool isShutdown) override;
+        virtual void Dispose(bool isShutdown) override;
+        virtual void Mark(Recycler *recycler) override { AssertMsg(false, "Mark called on object that isn't TrackableObject"); }
+    };
+
     struct RegexPattern : FinalizableObject
     {
         Field(RegExpTestCache*) testCache;
@@ -39,6 +56,9 @@ namespace UnifiedRegex
         Field(bool) isLiteral : 1;
         Field(bool) isShallowClone : 1;
 
+        // Set if the program is shared with other script contexts of the runtime, in which case it owns the program body
+        Field(SharedRegexProgram*) sharedProgram;
+
         union Rep
         {
             Field(UnifiedRep) unified;
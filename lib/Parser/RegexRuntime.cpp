@@ -3,6 +3,7 @@
 // Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
 //-------------------------------------------------------------------------------------------------------
 #include "ParserPch.h"
+#include "Core/StringKernels.h"
 
 namespace UnifiedRegex
 {
@@ -134,6 +135,18 @@ namespace UnifiedRegex
     }
 #endif
 
+    inline bool Matcher::UseVectorScan() const
+    {
+#if ENABLE_REGEX_CONFIG_OPTIONS
+        // Profiling keeps the scalar loops so that the comparison counts stay meaningful
+        if (stats != nullptr)
+        {
+            return false;
+        }
+#endif
+        return useVectorScan;
+    }
+
     inline void Matcher::QueryContinue(uint &qcTicks)
     {
         // See definition of TimePerQc for description of regex QC heuristics
@@ -555,6 +568,17 @@ namespace UnifiedRegex
             return false;
         }
 
+        if (matcher.UseVectorScan())
+        {
+            const char16* const found = StringKernels::FindLiteral(input + inputOffset, input + inputLength, cs, 2);
+            if (found == input + inputLength)
+            {
+                return false;
+            }
+            inputOffset = (CharCount)(found - input);
+            return true;
+        }
+
         const uint matchC0 = Chars<char16>::CTU(cs[0]);
         const uint matchC1 = Chars<char16>::CTU(cs[1]);
 
@@ -651,6 +675,21 @@ namespace UnifiedRegex
     ScannerMixinT<ScannerT>::Match(Matcher& matcher, const char16 * const input, const CharCount inputLength, CharCount& inputOffset) const
     {
         Assert(length <= matcher.program->rep.insts.litbufLen - offset);
+
+        // A vector step tests 8 candidate positions, which is as far as Boyer-Moore can skip for literals this short
+        const CharCount maxVectorScanLength = 8;
+        if (length <= maxVectorScanLength && matcher.UseVectorScan())
+        {
+            const char16* const found =
+                StringKernels::FindLiteral(input + inputOffset, input + inputLength, matcher.program->rep.insts.litbuf + offset, length);
+            if (found == input + inputLength)
+            {
+                return false;
+            }
+            inputOffset = (CharCount)(found - input);
+            return true;
+        }
+
         return scanner.template Match<1>(
             input
             , inputLength
@@ -726,6 +765,57 @@ namespace UnifiedRegex
         return program->AddScannerForSyncToLiterals(recycler, numLiterals++, offset, length, isEquivClass);
     }
 
+    void ScannersMixin::AddFirstChars(const char16* literal, bool isEquivClass)
+    {
+        CompileAssert(MaxNumFirstChars <= StringKernels::MaxAnyChars);
+
+        const int numEquivs = isEquivClass ? CaseInsensitive::EquivClassSize : 1;
+        for (int i = 0; i < numEquivs && numFirstChars >= 0; i++)
+        {
+            bool isNew = true;
+            for (int j = 0; j < numFirstChars && isNew; j++)
+            {
+                isNew = firstChars[j] != literal[i];
+            }
+
+            if (!isNew)
+            {
+                continue;
+            }
+
+            if (numFirstChars == MaxNumFirstChars)
+            {
+                numFirstChars = -1;
+            }
+            else
+            {
+                firstChars[numFirstChars++] = literal[i];
+            }
+        }
+    }
+
+    // Match of the literal of info at inputOffset, which must leave room for it
+    static inline bool IsSyncLiteralAt(const ScannerInfo* info, const char16* const litbuf, const char16* const input, const CharCount inputOffset)
+    {
+        const char16* const literal = litbuf + info->offset;
+        if (!info->isEquivClass)
+        {
+            return wmemcmp(input + inputOffset, literal, info->length) == 0;
+        }
+
+        CompileAssert(CaseInsensitive::EquivClassSize == 4);
+        for (CharCount i = 0; i < info->length; i++)
+        {
+            const char16 c = input[inputOffset + i];
+            const char16* const equivs = literal + i * CaseInsensitive::EquivClassSize;
+            if (c != equivs[0] && c != equivs[1] && c != equivs[2] && c != equivs[3])
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     void ScannersMixin::FreeBody(ArenaAllocator* rtAllocator)
     {
         for (int i = 0; i < numLiterals; i++)
@@ -762,6 +852,32 @@ namespace UnifiedRegex
         set.FreeBody(rtAllocator);
     }
 
+    // ----------------------------------------------------------------------
+    // SyncRanges
+    // ----------------------------------------------------------------------
+
+    void SyncRanges::Setup(CharSet<char16>& set)
+    {
+        CompileAssert(MaxRanges == StringKernels::MaxRanges);
+
+        int count = 0;
+        uint searchStart = 0;
+        char16 lower, upper;
+        while (searchStart <= Chars<char16>::MaxUChar && set.GetNextRange((char16)searchStart, &lower, &upper))
+        {
+            if (count == MaxRanges)
+            {
+                numRanges = 0;
+                return;
+            }
+            bounds[count * 2] = lower;
+            bounds[count * 2 + 1] = upper;
+            count++;
+            searchStart = (uint)upper + 1;
+        }
+        numRanges = (uint8)count;
+    }
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
     template<bool IsNegation>
     void SetMixin<IsNegation>::Print(DebugWriter* w, const char16* litbuf) const
@@ -1818,12 +1934,19 @@ namespace UnifiedRegex
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
-        while (inputOffset < inputLength && input[inputOffset] != matchC)
+        if (matcher.UseVectorScan())
+        {
+            inputOffset = (CharCount)(StringKernels::FindChar(input + inputOffset, input + inputLength, matchC) - input);
+        }
+        else
         {
+            while (inputOffset < inputLength && input[inputOffset] != matchC)
+            {
 #if ENABLE_REGEX_CONFIG_OPTIONS
-            matcher.CompStats();
+                matcher.CompStats();
 #endif
-            inputOffset++;
+                inputOffset++;
+            }
         }
 
         matchStart = inputOffset;
@@ -1853,12 +1976,19 @@ namespace UnifiedRegex
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
-        while (inputOffset < inputLength && input[inputOffset] != matchC0 && input[inputOffset] != matchC1)
+        if (matcher.UseVectorScan())
+        {
+            inputOffset = (CharCount)(StringKernels::FindAnyChar(input + inputOffset, input + inputLength, cs, 2) - input);
+        }
+        else
         {
+            while (inputOffset < inputLength && input[inputOffset] != matchC0 && input[inputOffset] != matchC1)
+            {
 #if ENABLE_REGEX_CONFIG_OPTIONS
-            matcher.CompStats();
+                matcher.CompStats();
 #endif
-            inputOffset++;
+                inputOffset++;
+            }
         }
 
         matchStart = inputOffset;
@@ -1889,12 +2019,20 @@ namespace UnifiedRegex
         matcher.CompStats();
 #endif
 
-        while (inputOffset < inputLength && matchSet.Get(input[inputOffset]) == IsNegation)
+        if (this->ranges.numRanges != 0 && matcher.UseVectorScan())
         {
+            inputOffset = (CharCount)(StringKernels::FindCharInRanges(
+                input + inputOffset, input + inputLength, this->ranges.bounds, this->ranges.numRanges, IsNegation) - input);
+        }
+        else
+        {
+            while (inputOffset < inputLength && matchSet.Get(input[inputOffset]) == IsNegation)
+            {
 #if ENABLE_REGEX_CONFIG_OPTIONS
-            matcher.CompStats();
+                matcher.CompStats();
 #endif
-            inputOffset++;
+                inputOffset++;
+            }
         }
 
         matchStart = inputOffset;
@@ -2017,12 +2155,19 @@ namespace UnifiedRegex
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
-        while (inputOffset < inputLength && input[inputOffset] != matchC)
+        if (matcher.UseVectorScan())
         {
+            inputOffset = (CharCount)(StringKernels::FindChar(input + inputOffset, input + inputLength, matchC) - input);
+        }
+        else
+        {
+            while (inputOffset < inputLength && input[inputOffset] != matchC)
+            {
 #if ENABLE_REGEX_CONFIG_OPTIONS
-            matcher.CompStats();
+                matcher.CompStats();
 #endif
-            inputOffset++;
+                inputOffset++;
+            }
         }
 
         if (inputOffset >= inputLength)
@@ -2057,12 +2202,19 @@ namespace UnifiedRegex
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
-        while (inputOffset < inputLength && (input[inputOffset] != matchC0 && input[inputOffset] != matchC1))
+        if (matcher.UseVectorScan())
         {
+            inputOffset = (CharCount)(StringKernels::FindAnyChar(input + inputOffset, input + inputLength, cs, 2) - input);
+        }
+        else
+        {
+            while (inputOffset < inputLength && (input[inputOffset] != matchC0 && input[inputOffset] != matchC1))
+            {
 #if ENABLE_REGEX_CONFIG_OPTIONS
-            matcher.CompStats();
+                matcher.CompStats();
 #endif
-            inputOffset++;
+                inputOffset++;
+            }
         }
 
         if (inputOffset >= inputLength)
@@ -2097,12 +2249,20 @@ namespace UnifiedRegex
 #if ENABLE_REGEX_CONFIG_OPTIONS
         matcher.CompStats();
 #endif
-        while (inputOffset < inputLength && matchSet.Get(input[inputOffset]) == IsNegation)
+        if (this->ranges.numRanges != 0 && matcher.UseVectorScan())
         {
+            inputOffset = (CharCount)(StringKernels::FindCharInRanges(
+                input + inputOffset, input + inputLength, this->ranges.bounds, this->ranges.numRanges, IsNegation) - input);
+        }
+        else
+        {
+            while (inputOffset < inputLength && matchSet.Get(input[inputOffset]) == IsNegation)
+            {
 #if ENABLE_REGEX_CONFIG_OPTIONS
-            matcher.CompStats();
+                matcher.CompStats();
 #endif
-            inputOffset++;
+                inputOffset++;
+            }
         }
 
         if (inputOffset >= inputLength)
@@ -2248,12 +2408,19 @@ namespace UnifiedRegex
         }
 
         const Char matchC = c;
-        while (inputOffset < inputLength && input[inputOffset] != matchC)
+        if (matcher.UseVectorScan())
+        {
+            inputOffset = (CharCount)(StringKernels::FindChar(input + inputOffset, input + inputLength, matchC) - input);
+        }
+        else
         {
+            while (inputOffset < inputLength && input[inputOffset] != matchC)
+            {
 #if ENABLE_REGEX_CONFIG_OPTIONS
-            matcher.CompStats();
+                matcher.CompStats();
 #endif
-            inputOffset++;
+                inputOffset++;
+            }
         }
 
         if (inputOffset >= inputLength)
@@ -2318,12 +2485,20 @@ namespace UnifiedRegex
         }
 
         const RuntimeCharSet<Char>& matchSet = this->set;
-        while (inputOffset < inputLength && matchSet.Get(input[inputOffset]) == IsNegation)
+        if (this->ranges.numRanges != 0 && matcher.UseVectorScan())
+        {
+            inputOffset = (CharCount)(StringKernels::FindCharInRanges(
+                input + inputOffset, input + inputLength, this->ranges.bounds, this->ranges.numRanges, IsNegation) - input);
+        }
+        else
         {
+            while (inputOffset < inputLength && matchSet.Get(input[inputOffset]) == IsNegation)
+            {
 #if ENABLE_REGEX_CONFIG_OPTIONS
-            matcher.CompStats();
+                matcher.CompStats();
 #endif
-            inputOffset++;
+                inputOffset++;
+            }
         }
 
         if (inputOffset >= inputLength)
@@ -2524,63 +2699,89 @@ namespace UnifiedRegex
         int besti = -1;
         CharCount bestMatchOffset = 0;
 
-        if (matcher.literalNextSyncInputOffsets == nullptr)
+        if (numFirstChars > 0 && matcher.UseVectorScan())
         {
-            Assert(numLiterals <= MaxNumSyncLiterals);
-            matcher.literalNextSyncInputOffsets =
-                RecyclerNewArrayLeaf(matcher.recycler, CharCount, ScannersMixin::MaxNumSyncLiterals);
-        }
-        CharCount* literalNextSyncInputOffsets = matcher.literalNextSyncInputOffsets;
+            // Scan for the first characters of all literals at once, and try the literals in order at each candidate
+            const char16* const litbuf = matcher.program->rep.insts.litbuf;
+            for (CharCount candidate = inputOffset; besti < 0; candidate++)
+            {
+                candidate = (CharCount)(StringKernels::FindAnyChar(input + candidate, input + inputLength, firstChars, numFirstChars) - input);
+                if (candidate >= inputLength)
+                {
+                    break;
+                }
 
-        if (firstIteration)
+                for (int i = 0; i < numLiterals; i++)
+                {
+                    if (infos[i]->length <= inputLength - candidate && IsSyncLiteralAt(infos[i], litbuf, input, candidate))
+                    {
+                        besti = i;
+                        bestMatchOffset = candidate;
+                        break;
+                    }
+                }
+            }
+        }
+        else
         {
-            for (int i = 0; i < numLiterals; i++)
+            if (matcher.literalNextSyncInputOffsets == nullptr)
             {
-                literalNextSyncInputOffsets[i] = inputOffset;
+                Assert(numLiterals <= MaxNumSyncLiterals);
+                matcher.literalNextSyncInputOffsets =
+                    RecyclerNewArrayLeaf(matcher.recycler, CharCount, ScannersMixin::MaxNumSyncLiterals);
             }
-        }
+            CharCount* literalNextSyncInputOffsets = matcher.literalNextSyncInputOffsets;
 
-        for (int i = 0; i < numLiterals; i++)
-        {
-            CharCount thisMatchOffset = literalNextSyncInputOffsets[i];
-            if (inputOffset > thisMatchOffset)
+            if (firstIteration)
             {
-                thisMatchOffset = inputOffset;
+                for (int i = 0; i < numLiterals; i++)
+                {
+                    literalNextSyncInputOffsets[i] = inputOffset;
+                }
             }
 
-            if (infos[i]->isEquivClass
-                ? (infos[i]->scanner.Match<CaseInsensitive::EquivClassSize>(
-                    input
-                    , inputLength
-                    , thisMatchOffset
-                    , matcher.program->rep.insts.litbuf + infos[i]->offset
-                    , infos[i]->length
+            for (int i = 0; i < numLiterals; i++)
+            {
+                CharCount thisMatchOffset = literalNextSyncInputOffsets[i];
+                if (inputOffset > thisMatchOffset)
+                {
+                    thisMatchOffset = inputOffset;
+                }
+
+                if (infos[i]->isEquivClass
+                    ? (infos[i]->scanner.Match<CaseInsensitive::EquivClassSize>(
+                        input
+                        , inputLength
+                        , thisMatchOffset
+                        , matcher.program->rep.insts.litbuf + infos[i]->offset
+                        , infos[i]->length
 #if ENABLE_REGEX_CONFIG_OPTIONS
-                    , matcher.stats
+                        , matcher.stats
 #endif
-                    ))
-                : (infos[i]->scanner.Match<1>(
-                    input
-                    , inputLength
-                    , thisMatchOffset
-                    , matcher.program->rep.insts.litbuf + infos[i]->offset
-                    , infos[i]->length
+                        ))
+                    : (infos[i]->scanner.Match<1>(
+                        input
+                        , inputLength
+                        , thisMatchOffset
+                        , matcher.program->rep.insts.litbuf + infos[i]->offset
+                        , infos[i]->length
 #if ENABLE_REGEX_CONFIG_OPTIONS
-                    , matcher.stats
+                        , matcher.stats
 #endif
-                    )))
-            {
-                if (besti < 0 || thisMatchOffset < bestMatchOffset)
+                        )))
                 {
-                    besti = i;
-                    bestMatchOffset = thisMatchOffset;
-                }
+                    if (besti < 0 || thisMatchOffset < bestMatchOffset)
+                    {
+                        besti = i;
+                        bestMatchOffset = thisMatchOffset;
+                    }
 
-                literalNextSyncInputOffsets[i] = thisMatchOffset;
-            }
-            else
-            {
-                literalNextSyncInputOffsets[i] = inputLength;
+                    literalNextSyncInputOffsets[i] = thisMatchOffset;
+                }
+                else
+                {
+                    literalNextSyncInputOffsets[i] = inputLength;
+                }
             }
         }
 
@@ -4923,6 +5124,10 @@ namespace UnifiedRegex
         , literalNextSyncInputOffsets(nullptr)
         , recycler(scriptContext->GetRecycler())
         , previousQcTime(0)
+        , interpretedMatchCount(0)
+        , linearInsts(nullptr)
+        , automatonThreads(nullptr)
+        , useVectorScan(REGEX_CONFIG_FLAG(RegexVectorScan) && StringKernels::IsVectorized())
 #if ENABLE_REGEX_CONFIG_OPTIONS
         , stats(0)
         , w(0)
@@ -5173,6 +5378,611 @@ namespace UnifiedRegex
         return WasLastMatchSuccessful();
     }
 
+    inline bool Matcher::UseAutomaton() const
+    {
+#if ENABLE_REGEX_CONFIG_OPTIONS
+        if (w != 0)
+        {
+            // Tracing shows each interpreted instruction
+            return false;
+        }
+#endif
+        return program->automaton != nullptr;
+    }
+
+    bool Matcher::MatchAutomaton(const Char* const input, const CharCount inputLength, CharCount offset, const bool tryLaterStarts)
+    {
+        const Automaton* const automaton = program->automaton;
+        Assert(automaton != nullptr);
+#if ENABLE_REGEX_CONFIG_OPTIONS
+        if (stats != 0)
+        {
+            stats->numAutomatonMatches++;
+        }
+#endif
+
+        if (automatonThreads == nullptr)
+        {
+            automatonThreads = AutomatonThreads::New(recycler, *automaton);
+        }
+
+        ResetInnerGroups(0, program->numGroups - 1);
+        return automaton->Match(input, inputLength, offset, tryLaterStarts, standardChars, *automatonThreads, groupInfos);
+    }
+
+    inline bool Matcher::UseLinearTier()
+    {
+#if ENABLE_REGEX_CONFIG_OPTIONS
+        if (w != 0)
+        {
+            // Tracing shows each interpreted instruction
+            return false;
+        }
+#endif
+        return linearInsts != nullptr || TryTierUpToLinear();
+    }
+
+    bool Matcher::TryTierUpToLinear()
+    {
+        const uint threshold = (uint)REGEX_CONFIG_FLAG(RegexLinearTierThreshold);
+        if (threshold == 0 || interpretedMatchCount == LinearTierIneligible || ++interpretedMatchCount < threshold)
+        {
+            return false;
+        }
+
+        linearInsts = LowerToLinear();
+        if (linearInsts == nullptr)
+        {
+            interpretedMatchCount = LinearTierIneligible;
+            return false;
+        }
+
+#if ENABLE_REGEX_CONFIG_OPTIONS
+        if (stats != 0)
+        {
+            stats->numLinearTierUps++;
+        }
+#endif
+        return true;
+    }
+
+    LinearInst* Matcher::LowerToLinear() const
+    {
+        const uint8 *const instsBegin = program->rep.insts.insts;
+        const uint8 *const instsEnd = instsBegin + program->rep.insts.instsLen;
+        const Char *const litbuf = program->rep.insts.litbuf;
+
+        // First pass checks that every instruction is supported and counts them, second pass lowers them
+        LinearInst* result = nullptr;
+        uint numInsts = 0;
+        for (int pass = 0; pass < 2; pass++)
+        {
+            uint i = 0;
+            const uint8* instPointer = instsBegin;
+            while (instPointer < instsEnd)
+            {
+                const Inst* inst = (const Inst*)instPointer;
+                LinearInst lowered(LinearInst::Kind::Succ);
+                size_t instSize;
+                switch (inst->tag)
+                {
+                case Inst::InstTag::Nop:
+                    instPointer += sizeof(NopInst);
+                    continue;
+
+                case Inst::InstTag::Succ:
+                    // Anything after the final Succ could only be reached by a jump
+                    if (instPointer + sizeof(SuccInst) != instsEnd)
+                    {
+                        return nullptr;
+                    }
+                    instSize = sizeof(SuccInst);
+                    break;
+
+                case Inst::InstTag::SyncToCharAndContinue:
+                case Inst::InstTag::SyncToCharAndConsume:
+                    // The sync instructions move the start of the match, which only makes sense before anything else
+                    if (i != 0)
+                    {
+                        return nullptr;
+                    }
+                    CompileAssert(sizeof(SyncToCharAndContinueInst) == sizeof(SyncToCharAndConsumeInst));
+                    lowered.kind = LinearInst::Kind::SyncToChar;
+                    lowered.consume = inst->tag == Inst::InstTag::SyncToCharAndConsume;
+                    lowered.cs[0] = ((const SyncToCharAndContinueInst*)inst)->c;
+                    instSize = sizeof(SyncToCharAndContinueInst);
+                    break;
+
+                case Inst::InstTag::SyncToSetAndContinue:
+                case Inst::InstTag::SyncToNegatedSetAndContinue:
+                    if (i != 0)
+                    {
+                        return nullptr;
+                    }
+                    lowered.kind = LinearInst::Kind::SyncToSet;
+                    lowered.isNegation = inst->tag == Inst::InstTag::SyncToNegatedSetAndContinue;
+                    lowered.set = &((const SyncToSetAndContinueInst<false>*)inst)->set;
+                    lowered.ranges = &((const SyncToSetAndContinueInst<false>*)inst)->ranges;
+                    instSize = sizeof(SyncToSetAndContinueInst<false>);
+                    break;
+
+                case Inst::InstTag::SyncToSetAndConsume:
+                case Inst::InstTag::SyncToNegatedSetAndConsume:
+                    if (i != 0)
+                    {
+                        return nullptr;
+                    }
+                    lowered.kind = LinearInst::Kind::SyncToSet;
+                    lowered.consume = true;
+                    lowered.isNegation = inst->tag == Inst::InstTag::SyncToNegatedSetAndConsume;
+                    lowered.set = &((const SyncToSetAndConsumeInst<false>*)inst)->set;
+                    lowered.ranges = &((const SyncToSetAndConsumeInst<false>*)inst)->ranges;
+                    instSize = sizeof(SyncToSetAndConsumeInst<false>);
+                    break;
+
+                case Inst::InstTag::MatchChar:
+                    lowered.kind = LinearInst::Kind::MatchChar;
+                    lowered.numChars = 1;
+                    lowered.cs[0] = ((const MatchCharInst*)inst)->c;
+                    instSize = sizeof(MatchCharInst);
+                    break;
+
+                case Inst::InstTag::MatchChar2:
+                    lowered.kind = LinearInst::Kind::MatchChar;
+                    lowered.numChars = 2;
+                    js_memcpy_s(lowered.cs, sizeof(lowered.cs), ((const MatchChar2Inst*)inst)->cs, 2 * sizeof(Char));
+                    instSize = sizeof(MatchChar2Inst);
+                    break;
+
+                case Inst::InstTag::MatchChar3:
+                    lowered.kind = LinearInst::Kind::MatchChar;
+                    lowered.numChars = 3;
+                    js_memcpy_s(lowered.cs, sizeof(lowered.cs), ((const MatchChar3Inst*)inst)->cs, 3 * sizeof(Char));
+                    instSize = sizeof(MatchChar3Inst);
+                    break;
+
+                case Inst::InstTag::MatchChar4:
+                    lowered.kind = LinearInst::Kind::MatchChar;
+                    lowered.numChars = 4;
+                    js_memcpy_s(lowered.cs, sizeof(lowered.cs), ((const MatchChar4Inst*)inst)->cs, 4 * sizeof(Char));
+                    instSize = sizeof(MatchChar4Inst);
+                    break;
+
+                case Inst::InstTag::MatchSet:
+                case Inst::InstTag::MatchNegatedSet:
+                    lowered.kind = LinearInst::Kind::MatchSet;
+                    lowered.isNegation = inst->tag == Inst::InstTag::MatchNegatedSet;
+                    lowered.set = &((const MatchSetInst<false>*)inst)->set;
+                    instSize = sizeof(MatchSetInst<false>);
+                    break;
+
+                case Inst::InstTag::MatchLiteral:
+                {
+                    const MatchLiteralInst* matchLiteral = (const MatchLiteralInst*)inst;
+                    lowered.kind = LinearInst::Kind::MatchLiteral;
+                    lowered.literal = litbuf + matchLiteral->offset;
+                    lowered.length = matchLiteral->length;
+                    instSize = sizeof(MatchLiteralInst);
+                    break;
+                }
+
+                case Inst::InstTag::ChompCharStar:
+                case Inst::InstTag::ChompCharPlus:
+                    lowered.kind = LinearInst::Kind::RepeatChar;
+                    lowered.cs[0] = ((const ChompCharInst<ChompMode::Star>*)inst)->c;
+                    lowered.length = inst->tag == Inst::InstTag::ChompCharPlus ? 1 : 0;
+                    lowered.upper = CharCountFlag;
+                    instSize = sizeof(ChompCharInst<ChompMode::Star>);
+                    break;
+
+                case Inst::InstTag::ChompSetStar:
+                case Inst::InstTag::ChompSetPlus:
+                    lowered.kind = LinearInst::Kind::RepeatSet;
+                    lowered.set = &((const ChompSetInst<ChompMode::Star>*)inst)->set;
+                    lowered.length = inst->tag == Inst::InstTag::ChompSetPlus ? 1 : 0;
+                    lowered.upper = CharCountFlag;
+                    instSize = sizeof(ChompSetInst<ChompMode::Star>);
+                    break;
+
+                case Inst::InstTag::ChompCharGroupStar:
+                case Inst::InstTag::ChompCharGroupPlus:
+                {
+                    const ChompCharGroupInst<ChompMode::Star>* chomp = (const ChompCharGroupInst<ChompMode::Star>*)inst;
+                    lowered.kind = LinearInst::Kind::RepeatChar;
+                    lowered.cs[0] = chomp->c;
+                    lowered.groupId = chomp->groupId;
+                    lowered.length = inst->tag == Inst::InstTag::ChompCharGroupPlus ? 1 : 0;
+                    lowered.upper = CharCountFlag;
+                    instSize = sizeof(ChompCharGroupInst<ChompMode::Star>);
+                    break;
+                }
+
+                case Inst::InstTag::ChompSetGroupStar:
+                case Inst::InstTag::ChompSetGroupPlus:
+                {
+                    const ChompSetGroupInst<ChompMode::Star>* chomp = (const ChompSetGroupInst<ChompMode::Star>*)inst;
+                    lowered.kind = LinearInst::Kind::RepeatSet;
+                    lowered.set = &chomp->set;
+                    lowered.groupId = chomp->groupId;
+                    lowered.length = inst->tag == Inst::InstTag::ChompSetGroupPlus ? 1 : 0;
+                    lowered.upper = CharCountFlag;
+                    instSize = sizeof(ChompSetGroupInst<ChompMode::Star>);
+                    break;
+                }
+
+                case Inst::InstTag::ChompCharBounded:
+                {
+                    const ChompCharBoundedInst* chomp = (const ChompCharBoundedInst*)inst;
+                    lowered.kind = LinearInst::Kind::RepeatChar;
+                    lowered.cs[0] = chomp->c;
+                    lowered.length = chomp->repeats.lower;
+                    lowered.upper = chomp->repeats.upper;
+                    instSize = sizeof(ChompCharBoundedInst);
+                    break;
+                }
+
+                case Inst::InstTag::ChompSetBounded:
+                {
+                    const ChompSetBoundedInst* chomp = (const ChompSetBoundedInst*)inst;
+                    lowered.kind = LinearInst::Kind::RepeatSet;
+                    lowered.set = &chomp->set;
+                    lowered.length = chomp->repeats.lower;
+                    lowered.upper = chomp->repeats.upper;
+                    instSize = sizeof(ChompSetBoundedInst);
+                    break;
+                }
+
+                case Inst::InstTag::BOIHardFailTest:
+                case Inst::InstTag::BOITest:
+                    lowered.kind = LinearInst::Kind::BOITest;
+                    lowered.canHardFail = inst->tag == Inst::InstTag::BOIHardFailTest;
+                    instSize = sizeof(BOITestInst<true>);
+                    break;
+
+                case Inst::InstTag::EOIHardFailTest:
+                case Inst::InstTag::EOITest:
+                    // Hard failing at the end of input only skips backtracking, of which there is none
+                    lowered.kind = LinearInst::Kind::EOITest;
+                    instSize = sizeof(EOITestInst<true>);
+                    break;
+
+                case Inst::InstTag::BOLTest:
+                    lowered.kind = LinearInst::Kind::BOLTest;
+                    instSize = sizeof(BOLTestInst);
+                    break;
+
+                case Inst::InstTag::EOLTest:
+                    lowered.kind = LinearInst::Kind::EOLTest;
+                    instSize = sizeof(EOLTestInst);
+                    break;
+
+                case Inst::InstTag::WordBoundaryTest:
+                case Inst::InstTag::NegatedWordBoundaryTest:
+                    lowered.kind = LinearInst::Kind::WordBoundaryTest;
+                    lowered.isNegation = inst->tag == Inst::InstTag::NegatedWordBoundaryTest;
+                    instSize = sizeof(WordBoundaryTestInst<false>);
+                    break;
+
+                case Inst::InstTag::BeginDefineGroup:
+                    lowered.kind = LinearInst::Kind::BeginDefineGroup;
+                    lowered.groupId = ((const BeginDefineGroupInst*)inst)->groupId;
+                    instSize = sizeof(BeginDefineGroupInst);
+                    break;
+
+                case Inst::InstTag::EndDefineGroup:
+                    lowered.kind = LinearInst::Kind::EndDefineGroup;
+                    lowered.groupId = ((const EndDefineGroupInst*)inst)->groupId;
+                    instSize = sizeof(EndDefineGroupInst);
+                    break;
+
+                case Inst::InstTag::DefineGroupFixed:
+                {
+                    const DefineGroupFixedInst* defineGroup = (const DefineGroupFixedInst*)inst;
+                    lowered.kind = LinearInst::Kind::DefineGroupFixed;
+                    lowered.groupId = defineGroup->groupId;
+                    lowered.length = defineGroup->length;
+                    instSize = sizeof(DefineGroupFixedInst);
+                    break;
+                }
+
+                default:
+                    // Anything else may jump, push a continuation or use the assertion stack
+                    return nullptr;
+                }
+
+                if (result != nullptr)
+                {
+                    Assert(i < numInsts);
+                    result[i] = lowered;
+                }
+                i++;
+                instPointer += instSize;
+            }
+
+            if (pass == 0)
+            {
+                Assert(i != 0);
+                numInsts = i;
+                result = RecyclerNewArrayLeaf(recycler, LinearInst, numInsts);
+            }
+            else
+            {
+                Assert(i == numInsts);
+            }
+        }
+
+        Assert(result[numInsts - 1].kind == LinearInst::Kind::Succ);
+        return result;
+    }
+
+    // Runs the lowered program once from matchStart. Returns true on a match. On failure, sets matchStart to the input
+    // length if no later start position can match either.
+    inline bool Matcher::RunLinear(const Char* const input, const CharCount inputLength, CharCount &matchStart, bool &definedGroups)
+    {
+        CharCount inputOffset = matchStart;
+        for (const LinearInst* inst = linearInsts; ; inst++)
+        {
+            switch (inst->kind)
+            {
+            case LinearInst::Kind::SyncToChar:
+            {
+                const Char matchC = inst->cs[0];
+                if (UseVectorScan())
+                {
+                    inputOffset = (CharCount)(StringKernels::FindChar(input + inputOffset, input + inputLength, matchC) - input);
+                }
+                else
+                {
+                    while (inputOffset < inputLength && input[inputOffset] != matchC)
+                    {
+                        inputOffset++;
+                    }
+                }
+                if (inst->consume)
+                {
+                    if (inputOffset >= inputLength)
+                    {
+                        matchStart = inputLength;
+                        return false;
+                    }
+                    matchStart = inputOffset++;
+                }
+                else
+                {
+                    matchStart = inputOffset;
+                }
+                break;
+            }
+
+            case LinearInst::Kind::SyncToSet:
+            {
+                const RuntimeCharSet<Char>& matchSet = *inst->set;
+                const bool isNegation = inst->isNegation;
+                if (inst->ranges->numRanges != 0 && UseVectorScan())
+                {
+                    inputOffset = (CharCount)(StringKernels::FindCharInRanges(
+                        input + inputOffset, input + inputLength, inst->ranges->bounds, inst->ranges->numRanges, isNegation) - input);
+                }
+                else
+                {
+                    while (inputOffset < inputLength && matchSet.Get(input[inputOffset]) == isNegation)
+                    {
+                        inputOffset++;
+                    }
+                }
+                if (inst->consume)
+                {
+                    if (inputOffset >= inputLength)
+                    {
+                        matchStart = inputLength;
+                        return false;
+                    }
+                    matchStart = inputOffset++;
+                }
+                else
+                {
+                    matchStart = inputOffset;
+                }
+                break;
+            }
+
+            case LinearInst::Kind::MatchChar:
+            {
+                if (inputOffset >= inputLength)
+                {
+                    return false;
+                }
+                const Char c = input[inputOffset];
+                uint j = 0;
+                while (j < inst->numChars && inst->cs[j] != c)
+                {
+                    j++;
+                }
+                if (j == inst->numChars)
+                {
+                    return false;
+                }
+                inputOffset++;
+                break;
+            }
+
+            case LinearInst::Kind::MatchSet:
+                if (inputOffset >= inputLength || inst->set->Get(input[inputOffset]) == inst->isNegation)
+                {
+                    return false;
+                }
+                inputOffset++;
+                break;
+
+            case LinearInst::Kind::MatchLiteral:
+            {
+                const CharCount length = inst->length;
+                if (length > inputLength - inputOffset)
+                {
+                    return false;
+                }
+                const Char* const literal = inst->literal;
+                const Char* const inputCurr = input + inputOffset;
+                for (CharCount j = 0; j < length; j++)
+                {
+                    if (literal[j] != inputCurr[j])
+                    {
+                        return false;
+                    }
+                }
+                inputOffset += length;
+                break;
+            }
+
+            case LinearInst::Kind::RepeatChar:
+            case LinearInst::Kind::RepeatSet:
+            {
+                const CharCount repeatStart = inputOffset;
+                const CharCount inputEndOffset =
+                    static_cast<CharCount>(inst->upper) >= inputLength - inputOffset
+                        ? inputLength
+                        : inputOffset + static_cast<CharCount>(inst->upper);
+                if (inst->kind == LinearInst::Kind::RepeatChar)
+                {
+                    const Char matchC = inst->cs[0];
+                    while (inputOffset < inputEndOffset && input[inputOffset] == matchC)
+                    {
+                        inputOffset++;
+                    }
+                }
+                else
+                {
+                    const RuntimeCharSet<Char>& matchSet = *inst->set;
+                    while (inputOffset < inputEndOffset && matchSet.Get(input[inputOffset]))
+                    {
+                        inputOffset++;
+                    }
+                }
+                if (inputOffset - repeatStart < inst->length)
+                {
+                    return false;
+                }
+                if (inst->groupId >= 0)
+                {
+                    GroupInfo *const groupInfo = GroupIdToGroupInfo(inst->groupId);
+                    groupInfo->offset = repeatStart;
+                    groupInfo->length = inputOffset - repeatStart;
+                    definedGroups = true;
+                }
+                break;
+            }
+
+            case LinearInst::Kind::BOITest:
+                if (inputOffset > 0)
+                {
+                    if (inst->canHardFail)
+                    {
+                        matchStart = inputLength;
+                    }
+                    return false;
+                }
+                break;
+
+            case LinearInst::Kind::EOITest:
+                if (inputOffset < inputLength)
+                {
+                    return false;
+                }
+                break;
+
+            case LinearInst::Kind::BOLTest:
+                if (inputOffset > 0 && !standardChars->IsNewline(input[inputOffset - 1]))
+                {
+                    return false;
+                }
+                break;
+
+            case LinearInst::Kind::EOLTest:
+                if (inputOffset < inputLength && !standardChars->IsNewline(input[inputOffset]))
+                {
+                    return false;
+                }
+                break;
+
+            case LinearInst::Kind::WordBoundaryTest:
+            {
+                const bool prev = inputOffset > 0 && standardChars->IsWord(input[inputOffset - 1]);
+                const bool curr = inputOffset < inputLength && standardChars->IsWord(input[inputOffset]);
+                if (inst->isNegation == (prev != curr))
+                {
+                    return false;
+                }
+                break;
+            }
+
+            case LinearInst::Kind::BeginDefineGroup:
+                GroupIdToGroupInfo(inst->groupId)->offset = inputOffset;
+                break;
+
+            case LinearInst::Kind::EndDefineGroup:
+            {
+                GroupInfo *const groupInfo = GroupIdToGroupInfo(inst->groupId);
+                Assert(inputOffset >= groupInfo->offset);
+                groupInfo->length = inputOffset - groupInfo->offset;
+                definedGroups = true;
+                break;
+            }
+
+            case LinearInst::Kind::DefineGroupFixed:
+            {
+                GroupInfo *const groupInfo = GroupIdToGroupInfo(inst->groupId);
+                groupInfo->offset = inputOffset - inst->length;
+                groupInfo->length = inst->length;
+                definedGroups = true;
+                break;
+            }
+
+            case LinearInst::Kind::Succ:
+            {
+                GroupInfo *const info = GroupIdToGroupInfo(0);
+                info->offset = matchStart;
+                info->length = inputOffset - matchStart;
+                return true;
+            }
+
+            default:
+                Assert(false);
+                __assume(false);
+            }
+        }
+    }
+
+    bool Matcher::MatchLinear(const Char* const input, const CharCount inputLength, CharCount offset, const bool tryLaterStarts)
+    {
+        Assert(linearInsts != nullptr);
+#if ENABLE_REGEX_CONFIG_OPTIONS
+        if (stats != 0)
+        {
+            stats->numLinearMatches++;
+        }
+#endif
+
+        ResetInnerGroups(0, program->numGroups - 1);
+
+        bool definedGroups = false;
+        do
+        {
+            if (RunLinear(input, inputLength, offset, definedGroups))
+            {
+                return true;
+            }
+
+            // Groups defined before the failing instruction must not leak into the next attempt or the result
+            if (definedGroups)
+            {
+                ResetInnerGroups(1, program->numGroups - 1);
+                definedGroups = false;
+            }
+        } while (tryLaterStarts && ++offset <= inputLength);
+
+        return false;
+    }
+
     inline bool Matcher::MatchSingleCharCaseInsensitive(const Char* const input, const CharCount inputLength, CharCount offset, const Char c)
     {
         CaseInsensitive::MappingSource mappingSource = program->GetCaseMappingSource();
@@ -5494,6 +6304,18 @@ namespace UnifiedRegex
             // fall through
 
         case Program::ProgramTag::InstructionsTag:
+            if (UseAutomaton())
+            {
+                res = MatchAutomaton(input, inputLength, offset, loopMatchHere);
+                break;
+            }
+
+            if (UseLinearTier())
+            {
+                res = MatchLinear(input, inputLength, offset, loopMatchHere);
+                break;
+            }
+
             {
                 previousQcTime = 0;
                 uint qcTicks = 0;
@@ -5668,6 +6490,7 @@ namespace UnifiedRegex
         rep.insts.litbuf = nullptr;
         rep.insts.litbufLen = 0;
         rep.insts.scannersForSyncToLiterals = nullptr;
+        automaton = nullptr;
     }
 
     Program *Program::New(Recycler *recycler, RegexFlags flags)
@@ -5675,6 +6498,11 @@ namespace UnifiedRegex
         return RecyclerNew(recycler, Program, flags);
     }
 
+    bool Program::IsShareableAcrossScriptContexts() const
+    {
+        return !OctoquadIdentifier::Qualifies(this);
+    }
+
     Field(ScannerInfo *)*Program::CreateScannerArrayForSyncToLiterals(Recycler *const recycler)
     {
         Assert(tag == ProgramTag::InstructionsTag);
@@ -5707,6 +6535,11 @@ namespace UnifiedRegex
 
     void Program::FreeBody(ArenaAllocator* rtAllocator)
     {
+        if (automaton != nullptr)
+        {
+            automaton->FreeBody(rtAllocator);
+        }
+
         if (tag != ProgramTag::InstructionsTag || !rep.insts.insts)
         {
             return;
@@ -5822,6 +6655,10 @@ namespace UnifiedRegex
                 }
                 w->Unindent();
                 w->PrintEOL(_u("}"));
+                if (automaton != nullptr)
+                {
+                    automaton->Print(w);
+                }
             }
             break;
         case ProgramTag::SingleCharTag:
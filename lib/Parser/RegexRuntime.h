@@ -17,6 +17,8 @@ namespace UnifiedRegex
     class ContStack;
     class AssertionStack;
     class OctoquadMatcher;
+    class Automaton;
+    struct AutomatonThreads;
 
     enum class ChompMode : uint8
     {
@@ -138,10 +140,18 @@ namespace UnifiedRegex
         };
         Field(RepType) rep;
 
+        // Linear-time alternative to the instructions for patterns prone to catastrophic backtracking (see
+        // RegexAutomaton.h), null if none. Only for the Instructions tags.
+        Field(Automaton*) automaton;
+
     public:
         Program(RegexFlags flags);
         static Program *New(Recycler *recycler, RegexFlags flags);
 
+        // True if a program compiled with these flags may be used by every script context of the runtime. Octoquad
+        // programs are not, since they are built against their script context's trigram alphabet.
+        bool IsShareableAcrossScriptContexts() const;
+
         static size_t GetOffsetOfTag() { return offsetof(Program, tag); }
         static size_t GetOffsetOfRep() { return offsetof(Program, rep); }
         static size_t GetOffsetOfBOILiteral2Literal() { return offsetof(BOILiteral2, literal); }
@@ -363,6 +373,32 @@ namespace UnifiedRegex
 #endif
     };
 
+    // The set of a sync instruction as a union of inclusive ranges, when it has few enough of them for the input to be
+    // scanned for it several characters at a time (see StringKernels::FindCharInRanges)
+    struct SyncRanges
+    {
+        static const int MaxRanges = 4;
+
+        uint8 numRanges; // 0 => set has more ranges, scan it one character at a time
+        char16 bounds[MaxRanges * 2];
+
+        // Only used at compile time
+        void Setup(CharSet<char16>& set);
+    };
+
+    template<bool IsNegation>
+    struct SyncSetMixin : SetMixin<IsNegation>
+    {
+        SyncRanges ranges;
+
+        // Only used at compile time
+        inline void CloneFrom(ArenaAllocator* rtAllocator, CharSet<char16>& source)
+        {
+            this->set.CloneFrom(rtAllocator, source);
+            ranges.Setup(source);
+        }
+    };
+
     struct TrieMixin
     {
         RuntimeCharTrie trie;
@@ -437,18 +473,25 @@ namespace UnifiedRegex
     struct ScannersMixin
     {
         static const int MaxNumSyncLiterals = 4;
+        static const int MaxNumFirstChars = 8;
 
         int numLiterals;
         Field(ScannerInfo*)* infos;
 
+        // Distinct characters (including case equivalents) the literals start with, to scan for them all at once,
+        // or -1 if there are more than MaxNumFirstChars
+        int numFirstChars;
+        char16 firstChars[MaxNumFirstChars];
+
         // scanner mixins must be added
         inline ScannersMixin(Recycler *const recycler, Program *const program)
-            : numLiterals(0), infos(program->CreateScannerArrayForSyncToLiterals(recycler))
+            : numLiterals(0), infos(program->CreateScannerArrayForSyncToLiterals(recycler)), numFirstChars(0)
         {
         }
 
         // Only used at compile time
         ScannerInfo* Add(Recycler *recycler, Program *program, CharCount offset, CharCount length, bool isEquivClass);
+        void AddFirstChars(const char16* literal, bool isEquivClass);
         void FreeBody(ArenaAllocator* rtAllocator);
 #if ENABLE_REGEX_CONFIG_OPTIONS
         void Print(DebugWriter* w, const char16* litbuf) const;
@@ -982,7 +1025,7 @@ namespace UnifiedRegex
     };
 
     template<bool IsNegation>
-    struct SyncToSetAndContinueInst : Inst, SetMixin<IsNegation>
+    struct SyncToSetAndContinueInst : Inst, SyncSetMixin<IsNegation>
     {
         // set must always be cloned from source
         inline SyncToSetAndContinueInst() : Inst(IsNegation ? InstTag::SyncToNegatedSetAndContinue : InstTag::SyncToSetAndContinue) {}
@@ -1057,7 +1100,7 @@ namespace UnifiedRegex
     };
 
     template<bool IsNegation>
-    struct SyncToSetAndConsumeInst : Inst, SetMixin<IsNegation>
+    struct SyncToSetAndConsumeInst : Inst, SyncSetMixin<IsNegation>
     {
         // set must always be cloned from source
         inline SyncToSetAndConsumeInst() : Inst(IsNegation ? InstTag::SyncToNegatedSetAndConsume : InstTag::SyncToSetAndConsume) {}
@@ -1125,7 +1168,7 @@ namespace UnifiedRegex
     };
 
     template<bool IsNegation>
-    struct SyncToSetAndBackupInst : Inst, SetMixin<IsNegation>, BackupMixin
+    struct SyncToSetAndBackupInst : Inst, SyncSetMixin<IsNegation>, BackupMixin
     {
         // set must always be cloned from source
         inline SyncToSetAndBackupInst(const CountDomain& backup) : Inst(IsNegation ? InstTag::SyncToNegatedSetAndBackup : InstTag::SyncToSetAndBackup), BackupMixin(backup) {}
@@ -1715,6 +1758,59 @@ namespace UnifiedRegex
         CONT_BODY
     };
 
+    // ----------------------------------------------------------------------
+    // LinearInst
+    // ----------------------------------------------------------------------
+
+    // A program whose instructions never push a continuation (character, set and literal matches, chomps, group
+    // definitions, position assertions, and a leading sync) cannot backtrack: the first instruction that fails ends the
+    // attempt at the current start position. Once such a program has been run often enough, the matcher lowers it to
+    // an array of these fixed-size instructions and runs them in a tight loop, without the continuation and assertion
+    // stacks or the group undo bookkeeping. Any other instruction keeps the program in the interpreter.
+    struct LinearInst : private Chars<char16>
+    {
+        enum class Kind : uint8
+        {
+            SyncToChar,         // cs[0], consume
+            SyncToSet,          // set, isNegation, consume
+            MatchChar,          // cs[0..numChars - 1] are alternatives for one input character
+            MatchSet,           // set, isNegation
+            MatchLiteral,       // literal, length
+            RepeatChar,         // cs[0], lower, upper, groupId
+            RepeatSet,          // set, lower, upper, groupId
+            BOITest,            // canHardFail
+            EOITest,
+            BOLTest,
+            EOLTest,
+            WordBoundaryTest,   // isNegation
+            BeginDefineGroup,   // groupId
+            EndDefineGroup,     // groupId
+            DefineGroupFixed,   // groupId, length
+            Succ
+        };
+
+        Kind kind;
+        bool isNegation;
+        bool consume;
+        bool canHardFail;
+        uint8 numChars;
+        int groupId;        // -1 => no group
+        Char cs[4];
+        // Point into the program's instructions and literal buffer, which live as long as the program
+        const RuntimeCharSet<Char>* set;
+        const SyncRanges* ranges; // SyncToSet only
+        const Char* literal;
+        CharCount length;   // literal or fixed group length, or lower bound of a repeat
+        CharCountOrFlag upper; // CharCountFlag => unbounded repeat
+
+        inline LinearInst(Kind kind = Kind::Succ)
+            : kind(kind), isNegation(false), consume(false), canHardFail(false), numChars(0), groupId(-1),
+            set(nullptr), ranges(nullptr), literal(nullptr), length(0), upper(0)
+        {
+            cs[0] = cs[1] = cs[2] = cs[3] = 0;
+        }
+    };
+
     // ----------------------------------------------------------------------
     // Matcher
     // ----------------------------------------------------------------------
@@ -1822,6 +1918,20 @@ namespace UnifiedRegex
 
         Field(uint) previousQcTime;
 
+        // Number of matches run by the interpreter so far, or LinearTierIneligible once the program was found to
+        // contain an instruction the linear tier does not support
+        Field(uint) interpretedMatchCount;
+        // Lowered form of the program (see LinearInst), null until the program tiers up
+        Field(LinearInst*) linearInsts;
+
+        static const uint LinearTierIneligible = UINT_MAX;
+
+        // Scratch space for running the program's automaton, null until first needed
+        Field(AutomatonThreads*) automatonThreads;
+
+        // Sync instructions scan the input with StringKernels rather than one character at a time
+        Field(bool) useVectorScan;
+
 #if ENABLE_REGEX_CONFIG_OPTIONS
         FieldNoBarrier(RegexStats*) stats;
         FieldNoBarrier(DebugWriter*) w;
@@ -1871,6 +1981,7 @@ namespace UnifiedRegex
 #endif
 
     private:
+        inline bool UseVectorScan() const;
         inline void QueryContinue(uint &qcTicks);
         void DoQueryContinue(const uint qcTicks);
     public:
@@ -1884,6 +1995,17 @@ namespace UnifiedRegex
         // As above, but control whether to try backtracking or later matches
         inline bool HardFail(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &inputOffset, const uint8 *&instPointer, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, HardFailMode mode);
 
+        // Automaton
+        inline bool UseAutomaton() const;
+        bool MatchAutomaton(const Char* const input, const CharCount inputLength, CharCount offset, const bool tryLaterStarts);
+
+        // Linear tier
+        inline bool UseLinearTier();
+        bool TryTierUpToLinear();
+        LinearInst* LowerToLinear() const;
+        bool MatchLinear(const Char* const input, const CharCount inputLength, CharCount offset, const bool tryLaterStarts);
+        inline bool RunLinear(const Char* const input, const CharCount inputLength, CharCount &matchStart, bool &definedGroups);
+
         inline void Run(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration);
         inline bool MatchHere(const Char* const input, const CharCount inputLength, CharCount &matchStart, CharCount &nextSyncInputOffset, ContStack &contStack, AssertionStack &assertionStack, uint &qcTicks, bool firstIteration);
 
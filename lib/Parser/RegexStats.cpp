@@ -19,6 +19,9 @@ namespace UnifiedRegex
         , numPops(0)
         , stackHWM(0)
         , numInsts(0)
+        , numLinearTierUps(0)
+        , numLinearMatches(0)
+        , numAutomatonMatches(0)
     {
         for (int i = 0; i < NumPhases; i++)
             phaseTicks[i] = 0;
@@ -113,6 +116,27 @@ namespace UnifiedRegex
             w->PrintEOL(_u("numInsts    : %10I64u   (%10.4f%%)"), numInsts, pc);
         }
 
+        if (numLinearTierUps > 0)
+        {
+            w->PrintEOL(_u("linearTierUp: %10I64u"), numLinearTierUps);
+        }
+
+        if (totals == 0 || totals->numLinearMatches == 0)
+            w->PrintEOL(_u("linearExecs : %10I64u"), numLinearMatches);
+        else
+        {
+            double pc = (double)numLinearMatches * 100.0 / (double)totals->numLinearMatches;
+            w->PrintEOL(_u("linearExecs : %10I64u   (%10.4f%%)"), numLinearMatches, pc);
+        }
+
+        if (totals == 0 || totals->numAutomatonMatches == 0)
+            w->PrintEOL(_u("nfaExecs    : %10I64u"), numAutomatonMatches);
+        else
+        {
+            double pc = (double)numAutomatonMatches * 100.0 / (double)totals->numAutomatonMatches;
+            w->PrintEOL(_u("nfaExecs    : %10I64u   (%10.4f%%)"), numAutomatonMatches, pc);
+        }
+
         w->Unindent();
     }
 
@@ -129,6 +153,9 @@ namespace UnifiedRegex
         if (other->stackHWM > stackHWM)
             stackHWM = other->stackHWM;
         numInsts += other->numInsts;
+        numLinearTierUps += other->numLinearTierUps;
+        numLinearMatches += other->numLinearMatches;
+        numAutomatonMatches += other->numAutomatonMatches;
     }
 
     RegexStats::Ticks RegexStatsDatabase::Now()
@@ -201,6 +228,16 @@ namespace UnifiedRegex
 
         totals.Print(w, 0, ticksPerMillisecond);
 
+        ThreadContext* threadContext = ThreadContext::GetContextForCurrentThread();
+        if (threadContext != nullptr)
+        {
+            const uint lookups = threadContext->GetSharedRegexProgramLookupCount();
+            const uint hits = threadContext->GetSharedRegexProgramHitCount();
+            w->PrintEOL(_u("Shared programs: compiles %u, hits %u, hit ratio %.1f%%, not shared as the cache was full %u"),
+                lookups - hits, hits, lookups == 0 ? 0.0 : 100.0 * hits / lookups,
+                threadContext->GetSharedRegexProgramCacheFullCount());
+        }
+
         allocator->Free(w, sizeof(DebugWriter));
     }
 }
@@ -52,6 +52,12 @@ namespace UnifiedRegex
         uint64 stackHWM;
         // Number of instructions executed
         uint64 numInsts;
+        // Number of times the program was lowered to the linear tier
+        uint64 numLinearTierUps;
+        // Number of matches run by the linear tier instead of the interpreter
+        uint64 numLinearMatches;
+        // Number of matches run by the automaton instead of the backtracking interpreter
+        uint64 numAutomatonMatches;
 
         RegexStats(RegexPattern* pattern);
 
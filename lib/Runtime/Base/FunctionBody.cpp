@@ -546,7 +546,6 @@ namespace Js
         m_envDepth((uint16)-1),
         loopInterpreterLimit(CONFIG_FLAG(LoopInterpretCount)),
         savedPolymorphicCacheState(0),
-        debuggerScopeIndex(0),
         m_hasFinally(false),
 #if ENABLE_PROFILE_INFO
         dynamicProfileInfo(nullptr),
@@ -567,7 +566,6 @@ namespace Js
         m_inlineCachesOnFunctionObject(false),
         m_hasDoneAllNonLocalReferenced(false),
         m_hasFunctionCompiledSent(false),
-        byteCodeCache(nullptr),
         m_hasLocalClosureRegister(false),
         m_hasParamClosureRegister(false),
         m_hasLocalFrameDisplayRegister(false),
@@ -594,6 +592,7 @@ namespace Js
         hasNestedLoop(false),
         recentlyBailedOutOfJittedLoopBody(false),
         m_isAsmJsScheduledForFullJIT(false),
+        m_isWasmScheduledForBaselineJIT(false),
         m_asmJsTotalLoopCount(0)
         //
         // Even if the function does not require any locals, we must always have "R0" to propagate
@@ -676,7 +675,6 @@ namespace Js
         m_envDepth((uint16)-1),
         loopInterpreterLimit(CONFIG_FLAG(LoopInterpretCount)),
         savedPolymorphicCacheState(0),
-        debuggerScopeIndex(0),
         m_hasFinally(false),
 #if ENABLE_PROFILE_INFO
         dynamicProfileInfo(nullptr),
@@ -697,7 +695,6 @@ namespace Js
         m_inlineCachesOnFunctionObject(false),
         m_hasDoneAllNonLocalReferenced(false),
         m_hasFunctionCompiledSent(false),
-        byteCodeCache(nullptr),
         m_hasLocalClosureRegister(false),
         m_hasParamClosureRegister(false),
         m_hasLocalFrameDisplayRegister(false),
@@ -724,6 +721,7 @@ namespace Js
         hasNestedLoop(false),
         recentlyBailedOutOfJittedLoopBody(false),
         m_isAsmJsScheduledForFullJIT(false),
+        m_isWasmScheduledForBaselineJIT(false),
         m_asmJsTotalLoopCount(0)
         //
         // Even if the function does not require any locals, we must always have "R0" to propagate
@@ -3941,6 +3939,15 @@ namespace Js
 
         this->CaptureDynamicProfileState(entryPointInfo);
 
+#ifdef ASMJS_PLAT
+        if(isAsmJs && entryPointInfo->GetJitMode() == ExecutionMode::SimpleJit)
+        {
+            // WebAssembly baseline code counts its calls down and schedules the full JIT on overflow
+            Assert(GetIsWasmBaselineJitScheduled());
+            entryPointInfo->callsCount = static_cast<uint32>(max(CONFIG_FLAG(WasmBaselineJitTierUpCount), 1)) - 1;
+        }
+        else
+#endif
         if(entryPointInfo->GetJitMode() == ExecutionMode::SimpleJit)
         {
             Assert(GetExecutionMode() == ExecutionMode::SimpleJit);
@@ -3959,6 +3966,7 @@ namespace Js
                         0xffu));
         }
         TraceExecutionMode();
+        TestTraceExecutionMode();
 
         JS_ETW(EtwTrace::LogMethodNativeLoadEvent(this, entryPointInfo));
 #ifdef VTUNE_PROFILING
@@ -5248,6 +5256,7 @@ namespace Js
         this->SetDebuggerScopeIndex(0);
 
         this->m_isAsmJsScheduledForFullJIT = false;
+        this->m_isWasmScheduledForBaselineJIT = false;
         this->m_asmJsTotalLoopCount = 0;
 
         recentlyBailedOutOfJittedLoopBody = false;
@@ -7098,21 +7107,36 @@ namespace Js
     {
         executionState.AssertIsInitialized();
 
-        if(!PHASE_TRACE(Phase::ExecutionModePhase, this))
-        {
-            return;
-        }
-
         switch(GetExecutionMode())
         {
             case ExecutionMode::Interpreter:
             case ExecutionMode::AutoProfilingInterpreter:
             case ExecutionMode::ProfilingInterpreter:
-                DoTraceExecutionMode(nullptr);
+                if(PHASE_TRACE(Phase::ExecutionModePhase, this))
+                {
+                    DoTraceExecutionMode(nullptr);
+                }
+                TestTraceExecutionMode();
                 break;
         }
     }
 
+    void FunctionBody::TestTraceExecutionMode() const
+    {
+        // Only self-hosted built-ins are reported, since their tiering differs from that of user code, and only the mode is
+        // printed so that the output does not depend on function numbers, byte code size or scaled limits
+        if(!PHASE_TESTTRACE(Phase::ExecutionModePhase, this) || !IsJsBuiltInCode())
+        {
+            return;
+        }
+
+        Output::Print(
+            _u("ExecutionMode - function: %s, mode: %S\n"),
+            GetDisplayName(),
+            ExecutionModeName(executionState.GetExecutionMode()));
+        Output::Flush();
+    }
+
     void FunctionBody::DoTraceExecutionMode(const char *const eventDescription) const
     {
         Assert(PHASE_TRACE(Phase::ExecutionModePhase, this));
@@ -9369,6 +9393,7 @@ namespace Js
                     newEntryPoint->SetIsAsmJSFunction(true);
                     newEntryPoint->jsMethod = AsmJsDefaultEntryThunk;
                     functionBody->SetIsAsmJsFullJitScheduled(false);
+                    functionBody->SetIsWasmBaselineJitScheduled(false);
                     functionBody->SetDefaultInterpreterExecutionMode();
                     this->functionProxy->SetOriginalEntryPoint(AsmJsDefaultEntryThunk);
                 }
@@ -9564,6 +9589,39 @@ namespace Js
         Output::Print(_u("Calls:%6d  Loads:%9d  Stores:%9d  Total refs:%9d\n"), this->callCountStats,
             loads, stores, loads + stores);
     }
+
+    void FunctionBody::DumpFootprint()
+    {
+        // Approximate per-function memory overhead, split into the fixed part of the function body and
+        // the on-demand side structures (aux pointers, counters, byte code and aux blocks).
+        size_t auxPtrsSize = 0;
+        uint auxPtrsCount = 0;
+        if (this->auxPtrs != nullptr)
+        {
+            const uint8 count = this->auxPtrs->count;
+            auxPtrsSize = count == AuxPtrsT::AuxPtrs16::MaxCount ? sizeof(AuxPtrsT::AuxPtrs16) :
+                count == AuxPtrsT::AuxPtrs32::MaxCount ? sizeof(AuxPtrsT::AuxPtrs32) :
+                offsetof(AuxPtrsT, ptrs) + this->auxPtrs->capacity * sizeof(void*);
+            for (uint8 i = 0; i < static_cast<uint8>(AuxPointerType::Max); i++)
+            {
+                if (this->GetAuxPtr(static_cast<AuxPointerType>(i)) != nullptr)
+                {
+                    auxPtrsCount++;
+                }
+            }
+        }
+        const size_t countersSize = this->counters.GetFieldSize() * static_cast<size_t>(CounterFields::Max);
+        const uint byteCodeSize = this->byteCodeBlock ? this->byteCodeBlock->GetLength() : 0;
+        const uint auxDataSize = this->GetAuxiliaryData() ? this->GetAuxiliaryData()->GetLength() : 0;
+        const uint auxContextDataSize = this->GetAuxiliaryContextData() ? this->GetAuxiliaryContextData()->GetLength() : 0;
+
+        this->DumpFullFunctionName();
+        Output::SkipToColumn(55);
+        Output::Print(_u("Body:%5u  AuxPtrs:%4u (%2u)  Counters:%4u  ByteCode:%7u  Aux:%7u  AuxContext:%6u  Total:%8u\n"),
+            (uint)sizeof(FunctionBody), (uint)auxPtrsSize, auxPtrsCount, (uint)countersSize,
+            byteCodeSize, auxDataSize, auxContextDataSize,
+            (uint)(sizeof(FunctionBody) + auxPtrsSize + countersSize + byteCodeSize + auxDataSize + auxContextDataSize));
+    }
 #endif
 
     Js::RegSlot FunctionBody::GetRestParamRegSlot()
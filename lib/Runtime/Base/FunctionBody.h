@@ -912,6 +912,7 @@ namespace Js
             CallSiteToCallApplyCallSiteArray = 27,
 #endif
             PrintOffsets = 28,
+            ByteCodeCache = 29,                   // Only set on functions deserialized from a byte code cache
             Max,
             Invalid = 0xff
         };
@@ -961,6 +962,7 @@ namespace Js
         AuxPointerTypeEntry(AuxPointerType::CallSiteToCallApplyCallSiteArray, ProfileId*);
 #endif
         AuxPointerTypeEntry(AuxPointerType::PrintOffsets, PrintOffsets*);
+        AuxPointerTypeEntry(AuxPointerType::ByteCodeCache, ByteCodeCache*);   // Not GC allocated so naked pointer
 #undef AuxPointerTypeEntry
 
         typedef AuxPtrs<FunctionProxy, AuxPointerType> AuxPtrsT;
@@ -1938,16 +1940,17 @@ namespace Js
                 LiteralRegexCount                       = 16,
                 InnerScopeCount                         = 17,
                 ProfiledCallApplyCallSiteCount          = 18,
+                DebuggerScopeIndex                      = 19,
 
                 // Following counters uses ((uint32)-1) as default value
-                LocalClosureRegister                    = 19,
-                ParamClosureRegister                    = 20,
-                LocalFrameDisplayRegister               = 21,
-                EnvRegister                             = 22,
-                ThisRegisterForEventHandler             = 23,
-                FirstInnerScopeRegister                 = 24,
-                FuncExprScopeRegister                   = 25,
-                FirstTmpRegister                        = 26,
+                LocalClosureRegister                    = 20,
+                ParamClosureRegister                    = 21,
+                LocalFrameDisplayRegister               = 22,
+                EnvRegister                             = 23,
+                ThisRegisterForEventHandler             = 24,
+                FirstInnerScopeRegister                 = 25,
+                FuncExprScopeRegister                   = 26,
+                FirstTmpRegister                        = 27,
 
                 Max
             };
@@ -2201,6 +2204,7 @@ namespace Js
         FieldWithBarrier(bool) m_hasActiveReference : 1;
 
         FieldWithBarrier(bool) m_isJsBuiltInForceInline : 1;
+        FieldWithBarrier(bool) m_isWasmScheduledForBaselineJIT : 1;
 #if DBG
         FieldWithBarrier(bool) m_isSerialized : 1;
 #endif
@@ -2229,7 +2233,6 @@ namespace Js
         FieldWithBarrier(uint) m_depth;
 
         FieldWithBarrier(uint32) loopInterpreterLimit;
-        FieldWithBarrier(uint32) debuggerScopeIndex;
         FieldWithBarrier(uint32) savedPolymorphicCacheState;
 
         // >>>>>>WARNING! WARNING!<<<<<<<<<<
@@ -2238,7 +2241,6 @@ namespace Js
         // copied in FunctionBody::Clone
         //
 
-        FieldNoBarrier(Js::ByteCodeCache*) byteCodeCache;   // Not GC allocated so naked pointer
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         static bool shareInlineCaches;
 #endif
@@ -2277,6 +2279,10 @@ namespace Js
 #endif
 
     public:
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+        void DumpFootprint();
+#endif
+
         FunctionBody(ByteCodeCache* cache, Utf8SourceInfo* sourceInfo, ScriptContext* scriptContext):
             ParseableFunctionInfo((JavascriptMethod) nullptr, 0, (LocalFunctionId) 0, sourceInfo, scriptContext, 0, nullptr, 0, 0, FunctionInfo::Attributes::None, Flags_None)
         {
@@ -2332,12 +2338,12 @@ namespace Js
         Var GetFormalsPropIdArrayOrNullObj();
         ByteBlock* GetByteCode() const;
         ByteBlock* GetOriginalByteCode(); // Returns original bytecode without probes (such as BPs).
-        Js::ByteCodeCache * GetByteCodeCache() const { return this->byteCodeCache; }
+        Js::ByteCodeCache * GetByteCodeCache() const { return this->GetAuxPtr<AuxPointerType::ByteCodeCache>(); }
         void SetByteCodeCache(Js::ByteCodeCache *byteCodeCache)
         {
             if (byteCodeCache != nullptr)
             {
-                this->byteCodeCache = byteCodeCache;
+                this->SetAuxPtr<AuxPointerType::ByteCodeCache>(byteCodeCache);
             }
         }
 #if DBG
@@ -2391,8 +2397,8 @@ namespace Js
         uint32 SetLoopInterpreterLimit(uint32 val) { return loopInterpreterLimit = val; }
 
         // Gets the next index for tracking debugger scopes (increments the internal counter as well).
-        uint32 GetNextDebuggerScopeIndex() { return debuggerScopeIndex++; }
-        void SetDebuggerScopeIndex(uint32 index) { debuggerScopeIndex = index; }
+        uint32 GetNextDebuggerScopeIndex() { return this->IncreaseCountField(CounterFields::DebuggerScopeIndex); }
+        void SetDebuggerScopeIndex(uint32 index) { this->SetCountField(CounterFields::DebuggerScopeIndex, index); }
 
         size_t GetLoopBodyName(uint loopNumber, _Out_writes_opt_z_(sizeInChars) WCHAR* displayName, _In_ size_t sizeInChars);
 
@@ -2411,6 +2417,8 @@ namespace Js
 #ifdef ASMJS_PLAT
         void SetIsAsmJsFullJitScheduled(bool val){ m_isAsmJsScheduledForFullJIT = val; }
         bool GetIsAsmJsFullJitScheduled(){ return m_isAsmJsScheduledForFullJIT; }
+        void SetIsWasmBaselineJitScheduled(bool val){ m_isWasmScheduledForBaselineJIT = val; }
+        bool GetIsWasmBaselineJitScheduled(){ return m_isWasmScheduledForBaselineJIT; }
         uint32 GetAsmJSTotalLoopCount() const
         {
             return m_asmJsTotalLoopCount;
@@ -2499,6 +2507,7 @@ namespace Js
         void TraceInterpreterExecutionMode() const;
     private:
         void DoTraceExecutionMode(const char *const eventDescription) const;
+        void TestTraceExecutionMode() const;
 
     public:
         bool DoSimpleJit() const;
@@ -2591,7 +2600,7 @@ namespace Js
         bool HasLineBreak() const;
         bool HasLineBreak(charcount_t start, charcount_t end) const;
 
-        bool HasGeneratedFromByteCodeCache() const { return this->byteCodeCache != nullptr; }
+        bool HasGeneratedFromByteCodeCache() const { return this->GetByteCodeCache() != nullptr; }
 
         void TrackLoad(int ichMin);
 
@@ -89,7 +89,10 @@ namespace Js
         // Based on which execution modes are disabled, calculate the number of additional iterations that need to be covered by
         // the execution mode that will scale with the full JIT threshold
         uint16 scale = 0;
+        uint16 skippedIterations = 0;
         const bool doInterpreterProfile = owner->DoInterpreterProfile();
+        const bool isEagerProfiledBuiltIn = owner->IsJsBuiltInCode() && CONFIG_FLAG(JsBuiltInEagerProfile) &&
+            !Configuration::Global.flags.EnforceExecutionModeLimits;
         if (!doInterpreterProfile)
         {
             scale +=
@@ -113,6 +116,15 @@ namespace Js
                 profilingInterpreter0Limit = 0;
             }
         }
+        else if (isEagerProfiledBuiltIn)
+        {
+            // Self-hosted built-ins are shared by all script in the process and are expected to get hot, so collect
+            // profile data from the first call and drop the auto-profiling iterations entirely instead of giving them
+            // to the execution mode that scales with the full JIT threshold.
+            skippedIterations = autoProfilingInterpreter0Limit + autoProfilingInterpreter1Limit;
+            autoProfilingInterpreter0Limit = 0;
+            autoProfilingInterpreter1Limit = 0;
+        }
         if (!owner->DoSimpleJit())
         {
             if (!CONFIG_FLAG(NewSimpleJit) && doInterpreterProfile)
@@ -132,8 +144,8 @@ namespace Js
             profilingInterpreter1Limit = 0;
         }
 
-        uint16 fullJitThresholdConfig = GetDefaultFullJitThreshold(isCoroutine);
-        if (!Configuration::Global.flags.EnforceExecutionModeLimits)
+        uint16 fullJitThresholdConfig = GetDefaultFullJitThreshold(isCoroutine) - skippedIterations;
+        if (!Configuration::Global.flags.EnforceExecutionModeLimits && !isEagerProfiledBuiltIn)
         {
             /*
             Scale the full JIT threshold based on some heuristics:
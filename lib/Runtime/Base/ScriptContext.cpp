@@ -1371,10 +1371,8 @@ namespace Js
         interpreterThunkEmitter = HeapNew(InterpreterThunkEmitter, this, SourceCodeAllocator(), this->GetThreadContext()->GetThunkPageAllocators());
 #endif
 
-#ifdef ASMJS_PLAT
-        asmJsInterpreterThunkEmitter = HeapNew(InterpreterThunkEmitter, this, SourceCodeAllocator(), this->GetThreadContext()->GetThunkPageAllocators(),
-            true);
-#endif
+        // The asm.js/wasm interpreter thunk emitter is created on first use (see GetNextDynamicAsmJsInterpreterThunk),
+        // since most script contexts never run asm.js or wasm code.
 
         JS_ETW(EtwTrace::LogScriptContextLoadEvent(this));
         JS_ETW_INTERNAL(EventWriteJSCRIPT_HOST_SCRIPT_CONTEXT_START(this));
@@ -5811,6 +5809,11 @@ ScriptContext::GetJitFuncRangeCache()
     JavascriptMethod ScriptContext::GetNextDynamicAsmJsInterpreterThunk(PVOID* ppDynamicInterpreterThunk)
     {
 #ifdef ASMJS_PLAT
+        if (this->asmJsInterpreterThunkEmitter == nullptr)
+        {
+            this->asmJsInterpreterThunkEmitter = HeapNew(InterpreterThunkEmitter, this, SourceCodeAllocator(), this->GetThreadContext()->GetThunkPageAllocators(),
+                true);
+        }
         return (JavascriptMethod)this->asmJsInterpreterThunkEmitter->GetNextThunk(ppDynamicInterpreterThunk);
 #else
         __debugbreak();
@@ -5838,6 +5841,7 @@ ScriptContext::GetJitFuncRangeCache()
     void ScriptContext::ReleaseDynamicAsmJsInterpreterThunk(BYTE* address, bool addtoFreeList)
     {
 #ifdef ASMJS_PLAT
+        Assert(this->asmJsInterpreterThunkEmitter != nullptr);
         this->asmJsInterpreterThunkEmitter->Release(address, addtoFreeList);
 #else
         Assert(UNREACHED);
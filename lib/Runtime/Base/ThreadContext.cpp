@@ -142,6 +142,10 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     sourceCodeSize(0),
     nativeCodeSize(0),
     threadAlloc(_u("TC"), GetPageAllocator(), Js::Throw::OutOfMemory),
+    sharedRegexAllocator(_u("TC-SharedRegex"), GetPageAllocator(), Js::Throw::OutOfMemory),
+    sharedRegexProgramLookups(0),
+    sharedRegexProgramHits(0),
+    sharedRegexProgramCacheFullCount(0),
     inlineCacheThreadInfoAllocator(_u("TC-InlineCacheInfo"), GetPageAllocator(), Js::Throw::OutOfMemory),
     isInstInlineCacheThreadInfoAllocator(_u("TC-IsInstInlineCacheInfo"), GetPageAllocator(), Js::Throw::OutOfMemory),
     equivalentTypeCacheInfoAllocator(_u("TC-EquivalentTypeCacheInfo"), GetPageAllocator(), Js::Throw::OutOfMemory),
@@ -462,6 +466,8 @@ ThreadContext::~ThreadContext()
             this->recyclableData->sourceProfileManagersByUrl->Count() == 0, "There seems to have been a refcounting imbalance.");
 
         this->recyclableData->sourceProfileManagersByUrl = nullptr;
+        this->recyclableData->sharedSourceInfos = nullptr;
+        this->recyclableData->sharedRegexPrograms = nullptr;
         this->recyclableData->oldEntryPointInfo = nullptr;
 
         if (this->recyclableData->symbolRegistrationMap != nullptr)
@@ -4236,6 +4242,127 @@ BOOL ThreadContext::IsNativeAddress(void * pCodeAddr, Js::ScriptContext* current
 }
 #endif
 
+Js::Utf8SourceInfo* ThreadContext::FindSharedSourceInfo(hash_t sourceHash)
+{
+    RecyclerWeakReference<Js::Utf8SourceInfo>* weakRef = nullptr;
+    if (this->recyclableData->sharedSourceInfos == nullptr ||
+        !this->recyclableData->sharedSourceInfos->TryGetValue(sourceHash, &weakRef))
+    {
+        return nullptr;
+    }
+
+    return weakRef->Get();
+}
+
+void ThreadContext::AddSharedSourceInfo(hash_t sourceHash, Js::Utf8SourceInfo* sourceInfo)
+{
+    if (this->recyclableData->sharedSourceInfos == nullptr)
+    {
+        this->EnsureRecycler();
+        this->recyclableData->sharedSourceInfos = RecyclerNew(GetRecycler(), SharedSourceInfoMap, GetRecycler());
+    }
+
+    SharedSourceInfoMap* sharedSourceInfos = this->recyclableData->sharedSourceInfos;
+    if (sharedSourceInfos->Count() >= INMEMORY_CACHE_MAX_SHARED_SOURCES)
+    {
+        // Drop the entries for sources that have been collected before giving up on sharing.
+        sharedSourceInfos->Cleanup();
+        if (sharedSourceInfos->Count() >= INMEMORY_CACHE_MAX_SHARED_SOURCES)
+        {
+            return;
+        }
+    }
+
+    sharedSourceInfos->Item(sourceHash, GetRecycler()->CreateWeakReferenceHandle(sourceInfo));
+}
+
+// A script context about to compile a regex first looks here for a program compiled by another script context of this
+// runtime. Programs are immutable once compiled, and all per-match state lives in each pattern's matcher, so one program
+// can serve every script context. Only one thread at a time can be in a runtime, so no locking is needed.
+//
+// Nothing is shared until the runtime has a second script context, so that a runtime with a single one does not move its
+// regexes into the shared allocator for no benefit.
+bool ThreadContext::IsSharingRegexPrograms() const
+{
+    return CONFIG_FLAG(ShareRegexPrograms) && this->scriptContextCount > 1;
+}
+
+UnifiedRegex::SharedRegexProgram* ThreadContext::FindSharedRegexProgram(const UnifiedRegex::RegexKey& key)
+{
+    if (!IsSharingRegexPrograms())
+    {
+        return nullptr;
+    }
+
+    this->sharedRegexProgramLookups++;
+
+    RecyclerWeakReference<UnifiedRegex::SharedRegexProgram>* weakRef = nullptr;
+    if (this->recyclableData->sharedRegexPrograms == nullptr ||
+        !this->recyclableData->sharedRegexPrograms->TryGetValue(key, &weakRef))
+    {
+        return nullptr;
+    }
+
+    UnifiedRegex::SharedRegexProgram* sharedProgram = weakRef->Get();
+    if (sharedProgram != nullptr)
+    {
+        this->sharedRegexProgramHits++;
+        if (PHASE_TESTTRACE1(Js::RegexCompilePhase))
+        {
+            Output::Print(_u("RegexCompile: using shared program: /%s/, flags: 0x%x\n"), key.Source(), key.Flags());
+            Output::Flush();
+        }
+    }
+    return sharedProgram;
+}
+
+// Returns the run-time allocator to compile a program that is to be shared with AddSharedRegexProgram, or null if the
+// program should be compiled into its script context instead. The cache only refers to shared programs weakly, so once
+// it is full, the entries of programs that are no longer used by any pattern are dropped to make room.
+ArenaAllocator* ThreadContext::GetSharedRegexAllocator()
+{
+    if (!IsSharingRegexPrograms())
+    {
+        return nullptr;
+    }
+
+    SharedRegexProgramMap* sharedRegexPrograms = this->recyclableData->sharedRegexPrograms;
+    if (sharedRegexPrograms != nullptr && sharedRegexPrograms->Count() >= INMEMORY_CACHE_MAX_SHARED_REGEX_PROGRAMS)
+    {
+        sharedRegexPrograms->Cleanup();
+        if (sharedRegexPrograms->Count() >= INMEMORY_CACHE_MAX_SHARED_REGEX_PROGRAMS)
+        {
+            this->sharedRegexProgramCacheFullCount++;
+            return nullptr;
+        }
+    }
+
+    return &this->sharedRegexAllocator;
+}
+
+void ThreadContext::AddSharedRegexProgram(UnifiedRegex::SharedRegexProgram* sharedProgram)
+{
+    Assert(IsSharingRegexPrograms());
+
+    if (this->recyclableData->sharedRegexPrograms == nullptr)
+    {
+        this->EnsureRecycler();
+        this->recyclableData->sharedRegexPrograms = RecyclerNew(GetRecycler(), SharedRegexProgramMap, GetRecycler());
+    }
+
+    // The key refers to the program's copy of the source, which the map entry keeps alive even after the program is gone
+    UnifiedRegex::Program* program = sharedProgram->program;
+    UnifiedRegex::RegexKey key(program->source, program->sourceLen, program->flags);
+    Assert(this->recyclableData->sharedRegexPrograms->Count() < INMEMORY_CACHE_MAX_SHARED_REGEX_PROGRAMS);
+    this->recyclableData->sharedRegexPrograms->Item(key, GetRecycler()->CreateWeakReferenceHandle(sharedProgram));
+
+    if (PHASE_TESTTRACE1(Js::RegexCompilePhase))
+    {
+        Output::Print(_u("RegexCompile: adding shared program: /%s/, flags: 0x%x\n"), program->source, program->flags);
+        Output::Flush();
+    }
+}
+
 #if ENABLE_PROFILE_INFO
 void ThreadContext::EnsureSourceProfileManagersByUrlMap()
 {
@@ -551,6 +551,8 @@ class ThreadContext sealed :
     };
 
     typedef JsUtil::BaseDictionary<const WCHAR*, SourceDynamicProfileManagerCache*, Recycler, PowerOf2SizePolicy> SourceProfileManagersByUrlMap;
+    typedef JsUtil::WeakReferenceDictionary<hash_t, Js::Utf8SourceInfo> SharedSourceInfoMap;
+    typedef JsUtil::WeakReferenceDictionary<UnifiedRegex::RegexKey, UnifiedRegex::SharedRegexProgram> SharedRegexProgramMap;
 
     struct RecyclableData
     {
@@ -618,6 +620,15 @@ class ThreadContext sealed :
         // See ES6 (draft 22) 19.4.2.2
         Field(SymbolRegistrationMap*) symbolRegistrationMap;
 
+        // Sources whose parsed metadata (e.g. the line offset cache) can be shared by every script context
+        // in this runtime that loads the same text, keyed by source hash.
+        Field(SharedSourceInfoMap*) sharedSourceInfos;
+
+        // Compiled regex programs, which are immutable, shared by every script context in this runtime that
+        // compiles the same source with the same flags, and held by the patterns using them. Each key refers to
+        // its program's copy of the source, which the map keeps alive. See ThreadContext::FindSharedRegexProgram.
+        Field(SharedRegexProgramMap*) sharedRegexPrograms;
+
 #ifdef ENABLE_SCRIPT_DEBUGGING
         // Just holding the reference to the returnedValueList of the stepController. This way that list will not get recycled prematurely.
         Field(Js::ReturnedValueList *) returnedValueList;
@@ -689,6 +700,11 @@ class ThreadContext sealed :
     Js::InterpreterStackFrame* leafInterpreterFrame;
     const Js::PropertyRecord * propertyNamesDirect[128];
     ArenaAllocator threadAlloc;
+    // Run-time allocator for the shared regex programs; see UnifiedRegex::SharedRegexProgram
+    ArenaAllocator sharedRegexAllocator;
+    uint sharedRegexProgramLookups;
+    uint sharedRegexProgramHits;
+    uint sharedRegexProgramCacheFullCount;
     ThreadServiceWrapper* threadServiceWrapper;
     uint functionCount;
     uint sourceInfoCount;
@@ -1529,6 +1545,19 @@ class ThreadContext sealed :
     uint ReleaseSourceDynamicProfileManagers(const WCHAR* url);
 #endif
 
+    Js::Utf8SourceInfo* FindSharedSourceInfo(hash_t sourceHash);
+    void AddSharedSourceInfo(hash_t sourceHash, Js::Utf8SourceInfo* sourceInfo);
+
+    bool IsSharingRegexPrograms() const;
+    UnifiedRegex::SharedRegexProgram* FindSharedRegexProgram(const UnifiedRegex::RegexKey& key);
+    ArenaAllocator* GetSharedRegexAllocator();
+    void AddSharedRegexProgram(UnifiedRegex::SharedRegexProgram* sharedProgram);
+    // Number of regex compilations that looked for a shared program, how many of them found one, and how many could
+    // not be shared because the cache was full of programs still in use
+    uint GetSharedRegexProgramLookupCount() const { return sharedRegexProgramLookups; }
+    uint GetSharedRegexProgramHitCount() const { return sharedRegexProgramHits; }
+    uint GetSharedRegexProgramCacheFullCount() const { return sharedRegexProgramCacheFullCount; }
+
     void EnsureSymbolRegistrationMap();
     const Js::PropertyRecord* GetSymbolFromRegistrationMap(const char16* stringKey, charcount_t stringLength);
     const Js::PropertyRecord* AddSymbolToRegistrationMap(const char16* stringKey, charcount_t stringLength);
@@ -258,6 +258,24 @@ namespace Js
     {
         if (this->m_lineOffsetCache == nullptr)
         {
+            // Script contexts in the same runtime share a recycler, so a line offset cache built for
+            // identical source text by another context can be used as is.
+            hash_t sourceHash = 0;
+            ThreadContext* threadContext = this->m_scriptContext->GetThreadContext();
+            bool shareLineOffsetCache = CONFIG_FLAG(ShareSourceMetadata) && !this->sourceHolder->IsEmpty();
+            if (shareLineOffsetCache)
+            {
+                sourceHash = Utf8SourceInfo::StaticGetHashCode(this);
+                Utf8SourceInfo* sharedSourceInfo = threadContext->FindSharedSourceInfo(sourceHash);
+                if (sharedSourceInfo != nullptr &&
+                    sharedSourceInfo->m_lineOffsetCache != nullptr &&
+                    Utf8SourceInfo::StaticEquals(this, sharedSourceInfo))
+                {
+                    this->m_lineOffsetCache = sharedSourceInfo->m_lineOffsetCache;
+                    return;
+                }
+            }
+
             LPCUTF8 sourceStart = this->GetSource(_u("Utf8SourceInfo::AllocateLineOffsetCache"));
             LPCUTF8 sourceEnd = sourceStart + this->GetCbLength(_u("Utf8SourceInfo::AllocateLineOffsetCache"));
 
@@ -267,6 +285,11 @@ namespace Js
 
             Recycler* recycler = this->m_scriptContext->GetRecycler();
             this->m_lineOffsetCache = RecyclerNew(recycler, LineOffsetCache, recycler, sourceAfterBOM, sourceEnd, startChar, (int)byteStartOffset);
+
+            if (shareLineOffsetCache)
+            {
+                threadContext->AddSharedSourceInfo(sourceHash, this);
+            }
         }
     }
 
@@ -3253,6 +3253,12 @@ void ByteCodeGenerator::EmitOneFunction(ParseNodeFnc *pnodeFnc)
         byteCodeFunction->DumpScopes();
     }
 #endif
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    if (PHASE_STATS(Js::FunctionBodyFootprintPhase, funcInfo->byteCodeFunction))
+    {
+        byteCodeFunction->DumpFootprint();
+    }
+#endif
 #if ENABLE_NATIVE_CODEGEN
     if ((!PHASE_OFF(Js::BackEndPhase, funcInfo->byteCodeFunction))
         && !this->forceNoNative
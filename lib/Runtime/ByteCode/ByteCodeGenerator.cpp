@@ -728,6 +728,8 @@ ByteCodeGenerator::ByteCodeGenerator(Js::ScriptContext* scriptContext, Js::Scope
     funcInfoStack(nullptr),
     jumpCleanupList(nullptr),
     pRootFunc(nullptr),
+    pPreviousVersionRootFunc(nullptr),
+    previousVersionUnchangedLength(0),
     pCurrentFunction(nullptr),
     globalScope(nullptr),
     currentScope(nullptr),
@@ -2042,6 +2044,7 @@ void ByteCodeGenerator::Generate(__in ParseNodeProg *pnodeProg, uint32 grfscr, _
     byteCodeGenerator->parser = parser;
     byteCodeGenerator->SetCurrentSourceIndex(sourceIndex);
     byteCodeGenerator->Begin(&localAlloc, grfscr, *ppRootFunc);
+    byteCodeGenerator->InitIncrementalReparse(grfscr);
     byteCodeGenerator->functionRef = functionRef;
     Visit(pnodeProg, byteCodeGenerator, Bind, AssignRegisters);
 
@@ -2212,6 +2215,121 @@ void ByteCodeGenerator::Begin(
     this->jumpCleanupList = Anew(alloc, JumpCleanupList, alloc);
 }
 
+void ByteCodeGenerator::InitIncrementalReparse(uint32 grfscr)
+{
+    this->pPreviousVersionRootFunc = nullptr;
+    this->previousVersionUnchangedLength = 0;
+
+    if (!CONFIG_FLAG(IncrementalReparse) ||
+        PHASE_OFF1(Js::IncrementalReparsePhase) ||
+        this->pRootFunc != nullptr ||
+        !this->IsInNonDebugMode() ||
+        (grfscr & (fscrDynamicCode | fscrEval | fscrIsModuleCode | fscrDeferredFnc)) != 0)
+    {
+        return;
+    }
+
+    Js::Utf8SourceInfo * currentSourceInfo = this->m_utf8SourceInfo;
+    SourceContextInfo * sourceContextInfo = currentSourceInfo->GetSrcInfo()->sourceContextInfo;
+    if (sourceContextInfo->IsDynamic())
+    {
+        return;
+    }
+
+    // The host reloads a source by running it again with the same source context, so the previous
+    // version is the most recently loaded source sharing our SourceContextInfo.
+    Js::Utf8SourceInfo * previousSourceInfo = nullptr;
+    this->scriptContext->MapScript([&](Js::Utf8SourceInfo * sourceInfo)
+    {
+        if (sourceInfo != currentSourceInfo &&
+            sourceInfo->GetSrcInfo()->sourceContextInfo == sourceContextInfo &&
+            (previousSourceInfo == nullptr || sourceInfo->GetSourceInfoId() > previousSourceInfo->GetSourceInfoId()))
+        {
+            previousSourceInfo = sourceInfo;
+        }
+    });
+
+    if (previousSourceInfo == nullptr ||
+        !previousSourceInfo->HasSource() ||
+        previousSourceInfo->IsInDebugMode() ||
+        previousSourceInfo->GetIsCesu8() != currentSourceInfo->GetIsCesu8() ||
+        previousSourceInfo->GetByteCodeGenerationFlags() != grfscr)
+    {
+        return;
+    }
+
+    JsUtil::List<Js::FunctionInfo *, Recycler> * topLevelFunctions = previousSourceInfo->GetTopLevelFunctionInfoList();
+    if (topLevelFunctions == nullptr || topLevelFunctions->Count() == 0)
+    {
+        return;
+    }
+
+    Js::FunctionInfo * previousRootInfo = topLevelFunctions->Item(0);
+    if (!previousRootInfo->HasBody() || !previousRootInfo->GetFunctionProxy()->IsFunctionBody())
+    {
+        return;
+    }
+
+    LPCUTF8 previousSource = previousSourceInfo->GetSource(_u("ByteCodeGenerator::InitIncrementalReparse"));
+    LPCUTF8 currentSource = currentSourceInfo->GetSource(_u("ByteCodeGenerator::InitIncrementalReparse"));
+    size_t cbCommon = min(previousSourceInfo->GetCbLength(_u("ByteCodeGenerator::InitIncrementalReparse")),
+        currentSourceInfo->GetCbLength(_u("ByteCodeGenerator::InitIncrementalReparse")));
+
+    size_t cbUnchanged = 0;
+    while (cbUnchanged < cbCommon && previousSource[cbUnchanged] == currentSource[cbUnchanged])
+    {
+        cbUnchanged++;
+    }
+
+    // Don't count a partially matching multi-unit character as unchanged.
+    while (cbUnchanged > 0 && cbUnchanged < cbCommon && (currentSource[cbUnchanged] & 0xC0) == 0x80)
+    {
+        cbUnchanged--;
+    }
+
+    this->pPreviousVersionRootFunc = previousRootInfo->GetFunctionProxy()->GetFunctionBody();
+    this->previousVersionUnchangedLength = currentSourceInfo->ByteIndexToCharacterIndex(cbUnchanged);
+
+    PHASE_PRINT_TRACE1(Js::IncrementalReparsePhase, _u("Incremental reparse: %u of %u characters unchanged from the previous version\n"),
+        this->previousVersionUnchangedLength, currentSourceInfo->GetCchLength());
+}
+
+Js::ParseableFunctionInfo * ByteCodeGenerator::FindReusableFunctionFromPreviousVersion(ParseNodeFnc * pnodeFnc, FuncInfo * parentFuncInfo, uint nestedIndex)
+{
+    // Only functions declared directly in global code are candidates: their byte code does not depend
+    // on any enclosing slot layout, so it is valid for any program with the same text up to their end.
+    if (this->pPreviousVersionRootFunc == nullptr ||
+        pnodeFnc->pnodeBody != nullptr ||
+        pnodeFnc->ichLim > this->previousVersionUnchangedLength ||
+        !parentFuncInfo->IsGlobalFunction() ||
+        this->GetCurrentScope() != parentFuncInfo->GetBodyScope() ||
+        nestedIndex >= this->pPreviousVersionRootFunc->GetNestedCount())
+    {
+        return nullptr;
+    }
+
+    Js::FunctionProxy * proxy = this->pPreviousVersionRootFunc->GetNestedFunctionProxy(nestedIndex);
+    if (proxy == nullptr || !proxy->IsFunctionBody())
+    {
+        return nullptr;
+    }
+
+    Js::FunctionBody * functionBody = proxy->GetFunctionBody();
+    if (functionBody->GetByteCode() == nullptr ||
+        functionBody->StartInDocument() != pnodeFnc->ichMin ||
+        functionBody->LengthInChars() != pnodeFnc->LengthInCodepoints() ||
+        functionBody->GetNestedCount() != pnodeFnc->nestedCount ||
+        (functionBody->GetAttributes() & StableFunctionInfoAttributesMask) != (GetFunctionInfoAttributes(pnodeFnc) & StableFunctionInfoAttributesMask))
+    {
+        return nullptr;
+    }
+
+    PHASE_PRINT_TRACE1(Js::IncrementalReparsePhase, _u("Incremental reparse: reusing %s (#%d) from the previous version\n"),
+        functionBody->GetDisplayName(), functionBody->GetFunctionNumber());
+
+    return functionBody;
+}
+
 HRESULT GenerateByteCode(__in ParseNodeProg *pnode, __in uint32 grfscr, __in Js::ScriptContext* scriptContext, __inout Js::ParseableFunctionInfo ** ppRootFunc,
                          __in uint sourceIndex, __in bool forceNoNative, __in Parser* parser, __in CompileScriptException *pse, Js::ScopeInfo* parentScopeInfo,
                         Js::ScriptFunction ** functionRef)
@@ -3380,6 +3498,10 @@ void VisitNestedScopes(ParseNode* pnodeScopeList, ParseNode* pnodeParent, ByteCo
                     }
                 }
             }
+            else
+            {
+                reuseNestedFunc = byteCodeGenerator->FindReusableFunctionFromPreviousVersion(pnodeFnc, parentFuncInfo, *pIndex);
+            }
             PreVisitFunction(pnodeFnc, byteCodeGenerator, reuseNestedFunc);
             FuncInfo *funcInfo = pnodeFnc->funcInfo;
 
@@ -81,6 +81,12 @@ class ByteCodeGenerator
 
     Js::Utf8SourceInfo *m_utf8SourceInfo;
 
+    // When a new version of a previously loaded source is compiled, the root function of the previous
+    // version and the number of leading characters both versions have in common. Compiled functions
+    // lying entirely in that unchanged prefix are reused instead of being parsed again.
+    Js::FunctionBody * pPreviousVersionRootFunc;
+    charcount_t previousVersionUnchangedLength;
+
     // The stack walker won't be able to find the current function being defer parse, pass in
     // The address so we can patch it up if it is a stack function and we need to box it.
     Js::ScriptFunction ** functionRef;
@@ -411,6 +417,9 @@ class ByteCodeGenerator
         __in uint32 grfscr,
         __in Js::ParseableFunctionInfo* pRootFunc);
 
+    void InitIncrementalReparse(uint32 grfscr);
+    Js::ParseableFunctionInfo * FindReusableFunctionFromPreviousVersion(ParseNodeFnc * pnodeFnc, FuncInfo * parentFuncInfo, uint nestedIndex);
+
     void SetCurrentSourceIndex(uint sourceIndex) { this->sourceIndex = sourceIndex; }
     uint GetCurrentSourceIndex() { return sourceIndex; }
 
@@ -18,6 +18,11 @@
 #include "Language/AsmJsModule.h"
 #include "Library/ES5Array.h"
 
+#ifdef ENABLE_WASM
+#include "../WasmReader/WasmReaderPch.h"
+#include "Language/WebAssemblySource.h"
+#endif
+
 void ChakraBinaryBuildDateTimeHash(DWORD * buildDateHash, DWORD * buildTimeHash);
 
 namespace Js
@@ -5100,6 +5105,515 @@ FunctionBody* ByteCodeSerializer::DeserializeFunction(ScriptContext* scriptConte
     return deserializedFunctionBody;
 }
 
+#ifdef ENABLE_WASM
+// --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+//  WebAssembly Module Cache Layout
+//  Offset      Size    Name                                    Value
+//  0       4       Magic Number                                "ChWm"
+//  4       4       Total File Size
+//  8       1       File Version Scheme                         as for byte code files
+//  9       16      Version DWORDs 1-4                          as for byte code files
+//  25      4       Expected Architecture
+//  29      4       Expected Op Code Count                      OpCodeAsmJs::Count
+//  33      4       Enabled WebAssembly Features
+//  37      4       Hash of the Module Binary
+//  41      4       Hash of the Rest of the File
+//  45      4       Size of the Module Binary
+//  49      n       Module Binary
+//  49+n    4       Count of Functions
+//  53+n    ...     Functions, each a flag saying whether its byte code is present followed by the byte code and register layout
+// --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
+
+const int magicWasmModuleConstant = *(int*)"ChWm";
+const uint32 wasmModuleHeaderSize = 45;
+
+enum WasmModuleFeatures : uint32
+{
+    WasmModuleFeatureSimd = 1 << 0,
+    WasmModuleFeatureThreads = 1 << 1,
+    WasmModuleFeatureNontrapping = 1 << 2,
+    WasmModuleFeatureSignExtends = 1 << 3,
+    WasmModuleFeatureMultiValue = 1 << 4,
+    WasmModuleFeatureBulkMemory = 1 << 5
+};
+
+// The byte code depends on which proposals are enabled, so a cache is only valid under the same configuration
+static uint32 GetWasmModuleFeatures()
+{
+    uint32 features = 0;
+    features |= Wasm::Simd::IsEnabled() ? WasmModuleFeatureSimd : 0;
+    features |= Wasm::Threads::IsEnabled() ? WasmModuleFeatureThreads : 0;
+    features |= Wasm::WasmNontrapping::IsEnabled() ? WasmModuleFeatureNontrapping : 0;
+    features |= Wasm::SignExtends::IsEnabled() ? WasmModuleFeatureSignExtends : 0;
+    features |= CONFIG_FLAG(WasmMultiValue) ? WasmModuleFeatureMultiValue : 0;
+    features |= Wasm::BulkMemory::IsEnabled() ? WasmModuleFeatureBulkMemory : 0;
+    return features;
+}
+
+static uint32 HashWasmModuleBytes(const byte * bytes, uint32 length)
+{
+    hash_t hash = CC_HASH_OFFSET_VALUE;
+    for (uint32 i = 0; i < length; i++)
+    {
+        CC_HASH_LOGIC(hash, (uint32)bytes[i]);
+    }
+    return hash;
+}
+
+// WebAssembly caches are versioned like byte code files, so that a new engine rejects the caches of the previous one
+static void GetWasmModuleFileVersion(byte * fileVersionScheme, DWORD * V1, DWORD * V2, DWORD * V3, DWORD * V4)
+{
+    byte scheme = CurrentFileVersionScheme;
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    if (Js::Configuration::Global.flags.ForceSerializedBytecodeVersionSchema)
+    {
+        scheme = (byte)Js::Configuration::Global.flags.ForceSerializedBytecodeVersionSchema;
+    }
+#endif
+
+    switch (scheme)
+    {
+    case EngineeringVersioningScheme:
+        Js::VerifyOkCatastrophic(AutoSystemInfo::GetJscriptFileVersion(V1, V2, V3, V4));
+        break;
+
+    case ReleaseVersioningScheme:
+        {
+            auto guidDWORDs = (DWORD*)(&byteCodeCacheReleaseFileVersion);
+            *V1 = guidDWORDs[0];
+            *V2 = guidDWORDs[1];
+            *V3 = guidDWORDs[2];
+            *V4 = guidDWORDs[3];
+            break;
+        }
+
+    default:
+        Throw::InternalError();
+        break;
+    }
+
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    if (Js::Configuration::Global.flags.ForceSerializedBytecodeMajorVersion)
+    {
+        *V1 = Js::Configuration::Global.flags.ForceSerializedBytecodeMajorVersion;
+        *V2 = 0;
+        *V3 = 0;
+        *V4 = 0;
+    }
+#endif
+    *fileVersionScheme = scheme;
+}
+
+class WasmModuleBufferBuilder
+{
+    BufferBuilderList all;
+    ArenaAllocator * alloc;
+
+public:
+    WasmModuleBufferBuilder(ArenaAllocator * alloc)
+        : all(_u("WebAssembly Module")), alloc(alloc)
+    {
+    }
+
+    // Entries are prepended, Create puts them back in order
+    void AddConstantInt32(LPCWSTR clue, int value, ConstantSizedBufferBuilderOf<int> ** entryOut = nullptr)
+    {
+        auto entry = Anew(alloc, ConstantSizedBufferBuilderOf<int>, clue, value);
+        all.list = all.list->Prepend(entry, alloc);
+        if (entryOut)
+        {
+            *entryOut = entry;
+        }
+    }
+
+    void AddByte(LPCWSTR clue, byte value)
+    {
+        auto entry = Anew(alloc, BufferBuilderByte, clue, value);
+        all.list = all.list->Prepend(entry, alloc);
+    }
+
+    void AddRaw(LPCWSTR clue, uint32 size, const byte * raw)
+    {
+        if (size != 0)
+        {
+            auto entry = Anew(alloc, BufferBuilderRaw, clue, size, raw);
+            all.list = all.list->Prepend(entry, alloc);
+        }
+    }
+
+    void AddFunction(FunctionBody * body)
+    {
+        ByteBlock * byteCode = body->GetByteCode();
+        AsmJsFunctionInfo * info = body->GetAsmJsFunctionInfo();
+        if (byteCode == nullptr || body->GetByteCodeCount() == 0 || info->GetLazyError() != nullptr || body->GetAuxiliaryData() != nullptr)
+        {
+            // Left for the deserialized module to compile when it is first called
+            AddByte(_u("Has Byte Code"), 0);
+            return;
+        }
+        AddByte(_u("Has Byte Code"), 1);
+
+        AddConstantInt32(_u("First Tmp Register"), body->GetFirstTmpRegister());
+        AddConstantInt32(_u("Constant Count"), body->GetConstantCount());
+        AddConstantInt32(_u("Var Count"), body->GetVarCount());
+        AddConstantInt32(_u("Out Param Max Depth"), body->GetOutParamMaxDepth());
+        AddConstantInt32(_u("Byte Code Count"), body->GetByteCodeCount());
+        AddConstantInt32(_u("Byte Code In Loop Count"), body->GetByteCodeInLoopCount());
+        AddConstantInt32(_u("Byte Code Without LDA Count"), body->GetByteCodeWithoutLDACount());
+        AddConstantInt32(_u("Profiled Call Site Count"), body->GetProfiledCallSiteCount());
+
+        uint loopCount = body->GetLoopCount();
+        AddConstantInt32(_u("Loop Count"), loopCount);
+        LoopHeader * loopHeaders = body->GetLoopHeaderArray();
+        AddByte(_u("Has Loop Headers"), loopHeaders != nullptr);
+        if (loopHeaders != nullptr)
+        {
+            for (uint i = 0; i < loopCount; i++)
+            {
+                AddConstantInt32(_u("Loop Start"), loopHeaders[i].startOffset);
+                AddConstantInt32(_u("Loop End"), loopHeaders[i].endOffset);
+                AddByte(_u("Loop Is Nested"), loopHeaders[i].isNested);
+            }
+        }
+
+        for (int i = 0; i < WAsmJs::LIMIT; i++)
+        {
+            WAsmJs::TypedSlotInfo * slotInfo = info->GetTypedSlotInfo((WAsmJs::Types)i);
+            AddConstantInt32(_u("Slot Const Count"), slotInfo->constCount);
+            AddConstantInt32(_u("Slot Var Count"), slotInfo->varCount);
+            AddConstantInt32(_u("Slot Tmp Count"), slotInfo->tmpCount);
+            AddConstantInt32(_u("Slot Byte Offset"), slotInfo->byteOffset);
+            AddConstantInt32(_u("Slot Const Source Byte Offset"), slotInfo->constSrcByteOffset);
+        }
+        AddConstantInt32(_u("Total Size In Bytes"), info->GetTotalSizeinBytes());
+
+        AddConstantInt32(_u("Byte Code Size"), byteCode->GetLength());
+        AddRaw(_u("Byte Code"), byteCode->GetLength(), byteCode->GetBuffer());
+    }
+
+    HRESULT Create(byte ** buffer, DWORD * bufferBytes, ConstantSizedBufferBuilderOf<int> * totalSize, ConstantSizedBufferBuilderOf<int> * payloadHash)
+    {
+        all.list = all.list->ReverseCurrentList();
+
+        DWORD size = all.FixOffset(0);
+        totalSize->value = size;
+        Assert(payloadHash->offset + sizeof(int32) == wasmModuleHeaderSize);
+
+        *buffer = AnewArray(alloc, byte, size);
+        all.Write(*buffer, size);
+
+        // Hash everything after the header once it is written, and patch the hash into the header
+        uint32 hash = HashWasmModuleBytes(*buffer + wasmModuleHeaderSize, size - wasmModuleHeaderSize);
+        js_memcpy_s(*buffer + payloadHash->offset, sizeof(uint32), &hash, sizeof(uint32));
+
+        *bufferBytes = size;
+        return S_OK;
+    }
+};
+
+class WasmModuleBufferReader
+{
+    const byte * current;
+    const byte * end;
+
+public:
+    WasmModuleBufferReader(const byte * buffer, DWORD bufferBytes)
+        : current(buffer), end(buffer + bufferBytes)
+    {
+    }
+
+    // Reads fail rather than run off the end of a truncated buffer
+    bool ReadInt32(uint32 * value)
+    {
+        if ((size_t)(end - current) < sizeof(uint32))
+        {
+            return false;
+        }
+        js_memcpy_s(value, sizeof(uint32), current, sizeof(uint32));
+        current += sizeof(uint32);
+        return true;
+    }
+
+    bool ReadByte(byte * value)
+    {
+        if (current == end)
+        {
+            return false;
+        }
+        *value = *current++;
+        return true;
+    }
+
+    bool ReadRaw(uint32 size, const byte ** raw)
+    {
+        if ((size_t)(end - current) < size)
+        {
+            return false;
+        }
+        *raw = current;
+        current += size;
+        return true;
+    }
+
+    bool IsAtEnd() const
+    {
+        return current == end;
+    }
+
+    HRESULT ReadHeader(DWORD bufferBytes)
+    {
+        uint32 magic, totalSize;
+        if (!ReadInt32(&magic) || magic != (uint32)magicWasmModuleConstant || !ReadInt32(&totalSize) || totalSize != bufferBytes)
+        {
+            return ByteCodeSerializer::InvalidByteCode;
+        }
+
+        byte expectedScheme;
+        DWORD expectedV1, expectedV2, expectedV3, expectedV4;
+        GetWasmModuleFileVersion(&expectedScheme, &expectedV1, &expectedV2, &expectedV3, &expectedV4);
+
+        byte scheme;
+        uint32 V1, V2, V3, V4;
+        if (!ReadByte(&scheme) || scheme != expectedScheme ||
+            !ReadInt32(&V1) || V1 != expectedV1 ||
+            !ReadInt32(&V2) || V2 != expectedV2 ||
+            !ReadInt32(&V3) || V3 != expectedV3 ||
+            !ReadInt32(&V4) || V4 != expectedV4)
+        {
+            // Written by a different engine
+            return ByteCodeSerializer::InvalidByteCode;
+        }
+
+        uint32 architecture, opCodeCount, features;
+        if (!ReadInt32(&architecture) || architecture != (uint32)magicArchitecture ||
+            !ReadInt32(&opCodeCount) || opCodeCount != (uint32)OpCodeAsmJs::Count ||
+            !ReadInt32(&features) || features != GetWasmModuleFeatures())
+        {
+            // Written by an engine with a different architecture or configuration
+            return ByteCodeSerializer::InvalidByteCode;
+        }
+
+        uint32 binaryHash, payloadHash;
+        if (!ReadInt32(&binaryHash) || !ReadInt32(&payloadHash) ||
+            payloadHash != HashWasmModuleBytes(current, (uint32)(end - current)))
+        {
+            // Corrupted
+            return ByteCodeSerializer::InvalidByteCode;
+        }
+        return S_OK;
+    }
+
+    HRESULT ReadFunction(ScriptContext * scriptContext, FunctionBody * body)
+    {
+        byte hasByteCode;
+        if (!ReadByte(&hasByteCode))
+        {
+            return ByteCodeSerializer::InvalidByteCode;
+        }
+        if (!hasByteCode)
+        {
+            if (!PHASE_ENABLED(WasmDeferredPhase, body))
+            {
+                // Without deferral a module is only created once all of its functions compile; let the caller compile it from scratch instead
+                try
+                {
+                    Wasm::WasmBytecodeGenerator::GenerateFunctionBytecode(scriptContext, body->GetAsmJsFunctionInfo()->GetWasmReaderInfo());
+                }
+                catch (Wasm::WasmCompilationException&)
+                {
+                    return ByteCodeSerializer::InvalidByteCode;
+                }
+            }
+            return S_OK;
+        }
+
+        uint32 firstTmpRegister, constantCount, varCount, outParamMaxDepth, byteCodeCount, byteCodeInLoopCount, byteCodeWithoutLDACount, profiledCallSiteCount, loopCount;
+        byte hasLoopHeaders;
+        if (!ReadInt32(&firstTmpRegister) || !ReadInt32(&constantCount) || !ReadInt32(&varCount) || !ReadInt32(&outParamMaxDepth) ||
+            !ReadInt32(&byteCodeCount) || !ReadInt32(&byteCodeInLoopCount) || !ReadInt32(&byteCodeWithoutLDACount) ||
+            !ReadInt32(&profiledCallSiteCount) || profiledCallSiteCount > Constants::NoProfileId ||
+            !ReadInt32(&loopCount) || !ReadByte(&hasLoopHeaders))
+        {
+            return ByteCodeSerializer::InvalidByteCode;
+        }
+
+        const byte * loopHeaders = nullptr;
+        const uint32 loopHeaderSize = 2 * sizeof(uint32) + sizeof(byte);
+        if (hasLoopHeaders && (loopCount > UINT32_MAX / loopHeaderSize || !ReadRaw(loopCount * loopHeaderSize, &loopHeaders)))
+        {
+            return ByteCodeSerializer::InvalidByteCode;
+        }
+
+        WAsmJs::TypedSlotInfo slotInfos[WAsmJs::LIMIT];
+        for (int i = 0; i < WAsmJs::LIMIT; i++)
+        {
+            uint32 constCount, varCount, tmpCount, byteOffset, constSrcByteOffset;
+            if (!ReadInt32(&constCount) || !ReadInt32(&varCount) || !ReadInt32(&tmpCount) || !ReadInt32(&byteOffset) || !ReadInt32(&constSrcByteOffset))
+            {
+                return ByteCodeSerializer::InvalidByteCode;
+            }
+            slotInfos[i].constCount = constCount;
+            slotInfos[i].varCount = varCount;
+            slotInfos[i].tmpCount = tmpCount;
+            slotInfos[i].byteOffset = byteOffset;
+            slotInfos[i].constSrcByteOffset = constSrcByteOffset;
+        }
+
+        uint32 totalSizeInBytes, byteCodeSize;
+        const byte * byteCode;
+        if (!ReadInt32(&totalSizeInBytes) || !ReadInt32(&byteCodeSize) || byteCodeSize == 0 || !ReadRaw(byteCodeSize, &byteCode))
+        {
+            return ByteCodeSerializer::InvalidByteCode;
+        }
+
+        // Leave the body as WasmBytecodeGenerator::GenerateFunction would have
+        body->CheckAndSetConstantCount(constantCount);
+        body->CheckAndSetVarCount(varCount);
+        body->SetFirstTmpRegister(firstTmpRegister);
+        body->CheckAndSetOutParamMaxDepth(outParamMaxDepth);
+        body->SetProfiledCallSiteCount((ProfileId)profiledCallSiteCount);
+        body->SetLoopCount(loopCount);
+
+        AsmJsFunctionInfo * info = body->GetAsmJsFunctionInfo();
+        for (int i = 0; i < WAsmJs::LIMIT; i++)
+        {
+            *info->GetTypedSlotInfo((WAsmJs::Types)i) = slotInfos[i];
+        }
+        info->SetTotalSizeinBytes(totalSizeInBytes);
+
+        ByteBlock * byteCodeBlock = ByteBlock::New(scriptContext->GetRecycler(), byteCode, byteCodeSize);
+        body->AllocateInlineCache();
+        body->AllocateObjectLiteralTypeArray();
+        body->AllocateForInCache();
+        if (loopHeaders != nullptr)
+        {
+            body->AllocateLoopHeaders();
+            for (uint32 i = 0; i < loopCount; i++)
+            {
+                LoopHeader * loopHeader = body->GetLoopHeader(i);
+                js_memcpy_s(&loopHeader->startOffset, sizeof(uint32), loopHeaders, sizeof(uint32));
+                js_memcpy_s(&loopHeader->endOffset, sizeof(uint32), loopHeaders + sizeof(uint32), sizeof(uint32));
+                loopHeader->isNested = loopHeaders[2 * sizeof(uint32)] != 0;
+                loopHeaders += loopHeaderSize;
+            }
+        }
+
+        body->MarkScript(byteCodeBlock, nullptr, nullptr, byteCodeCount, byteCodeInLoopCount, byteCodeWithoutLDACount);
+#if ENABLE_PROFILE_INFO
+        body->LoadDynamicProfileInfo();
+#endif
+        return S_OK;
+    }
+};
+
+HRESULT ByteCodeSerializer::SerializeWasmModule(ScriptContext * scriptContext, ArenaAllocator * alloc, WebAssemblyModule * module, byte ** buffer, DWORD * bufferBytes)
+{
+    WasmModuleBufferBuilder builder(alloc);
+
+    byte fileVersionScheme;
+    DWORD V1, V2, V3, V4;
+    GetWasmModuleFileVersion(&fileVersionScheme, &V1, &V2, &V3, &V4);
+
+    ConstantSizedBufferBuilderOf<int> * totalSize;
+    ConstantSizedBufferBuilderOf<int> * payloadHash;
+    builder.AddConstantInt32(_u("Magic"), magicWasmModuleConstant);
+    builder.AddConstantInt32(_u("Total Size"), 0, &totalSize);
+    builder.AddByte(_u("FileVersionKind"), fileVersionScheme);
+    builder.AddConstantInt32(_u("V1"), V1);
+    builder.AddConstantInt32(_u("V2"), V2);
+    builder.AddConstantInt32(_u("V3"), V3);
+    builder.AddConstantInt32(_u("V4"), V4);
+    builder.AddConstantInt32(_u("Expected Architecture"), magicArchitecture);
+    builder.AddConstantInt32(_u("Expected Number of OpCodes"), (int)OpCodeAsmJs::Count);
+    builder.AddConstantInt32(_u("Features"), GetWasmModuleFeatures());
+    builder.AddConstantInt32(_u("Binary Hash"), HashWasmModuleBytes(module->GetBinaryBuffer(), module->GetBinaryBufferLength()));
+    builder.AddConstantInt32(_u("Payload Hash"), 0, &payloadHash);
+
+    builder.AddConstantInt32(_u("Binary Size"), module->GetBinaryBufferLength());
+    builder.AddRaw(_u("Binary"), module->GetBinaryBufferLength(), module->GetBinaryBuffer());
+
+    builder.AddConstantInt32(_u("Function Count"), module->GetWasmFunctionCount());
+    for (uint i = 0; i < module->GetWasmFunctionCount(); ++i)
+    {
+        FunctionBody * body = module->GetWasmFunctionInfo(i)->GetBody();
+        AsmJsFunctionInfo * info = body->GetAsmJsFunctionInfo();
+        if (body->GetByteCodeCount() == 0 && info->GetLazyError() == nullptr)
+        {
+            // Compile the functions which haven't been called yet, so that the cache covers the whole module
+            try
+            {
+                Wasm::WasmBytecodeGenerator::GenerateFunctionBytecode(scriptContext, info->GetWasmReaderInfo());
+            }
+            catch (Wasm::WasmCompilationException&)
+            {
+                // Left for the first call to report
+            }
+        }
+        builder.AddFunction(body);
+    }
+
+    return builder.Create(buffer, bufferBytes, totalSize, payloadHash);
+}
+
+HRESULT ByteCodeSerializer::DeserializeWasmModule(ScriptContext * scriptContext, const byte * buffer, DWORD bufferBytes, WebAssemblyModule ** module)
+{
+    *module = nullptr;
+
+    WasmModuleBufferReader reader(buffer, bufferBytes);
+    HRESULT hr = reader.ReadHeader(bufferBytes);
+    if (FAILED(hr))
+    {
+        return hr;
+    }
+
+    uint32 binarySize;
+    const byte * binary;
+    if (!reader.ReadInt32(&binarySize) || binarySize == 0 || !reader.ReadRaw(binarySize, &binary))
+    {
+        return ByteCodeSerializer::InvalidByteCode;
+    }
+
+    byte * binaryCopy = RecyclerNewArrayLeaf(scriptContext->GetRecycler(), byte, binarySize);
+    js_memcpy_s(binaryCopy, binarySize, binary, binarySize);
+    WebAssemblySource src(binaryCopy, binarySize, true, scriptContext);
+
+    WebAssemblyModule * webAssemblyModule = nullptr;
+    try
+    {
+        // The module sections are cheap to decode compared to the function bodies, which are restored below
+        Wasm::WasmModuleGenerator bytecodeGen(scriptContext, &src);
+        webAssemblyModule = bytecodeGen.GenerateModule();
+    }
+    catch (Wasm::WasmCompilationException&)
+    {
+        return ByteCodeSerializer::InvalidByteCode;
+    }
+
+    uint32 functionCount;
+    if (!reader.ReadInt32(&functionCount) || functionCount != webAssemblyModule->GetWasmFunctionCount())
+    {
+        return ByteCodeSerializer::InvalidByteCode;
+    }
+
+    for (uint i = 0; i < functionCount; ++i)
+    {
+        hr = reader.ReadFunction(scriptContext, webAssemblyModule->GetWasmFunctionInfo(i)->GetBody());
+        if (FAILED(hr))
+        {
+            return hr;
+        }
+    }
+
+    if (!reader.IsAtEnd())
+    {
+        return ByteCodeSerializer::InvalidByteCode;
+    }
+
+    *module = webAssemblyModule;
+    return S_OK;
+}
+#endif
+
 SerializedAuxiliary::SerializedAuxiliary( uint offset, SerializedAuxiliaryKind kind ) :
     offset(offset), kind(kind)
 #ifdef BYTE_CODE_MAGIC_CONSTANTS
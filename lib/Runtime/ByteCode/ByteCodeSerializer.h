@@ -193,6 +193,15 @@ namespace Js
 
         static void ReadSourceInfo(const DeferDeserializeFunctionInfo* deferredFunction, int& lineNumber, int& columnNumber, bool& m_isEval, bool& m_isDynamicFunction);
 
+#ifdef ENABLE_WASM
+        // Serialize a WebAssembly module: its binary and the byte code of its functions. Functions which haven't been compiled yet are compiled first.
+        static HRESULT SerializeWasmModule(ScriptContext * scriptContext, ArenaAllocator * alloc, WebAssemblyModule * module, byte ** buffer, DWORD * bufferBytes);
+
+        // Re-create a WebAssembly module from the output of SerializeWasmModule. The module sections are decoded again, but the functions
+        // take their byte code from the buffer instead of being decoded and validated.
+        static HRESULT DeserializeWasmModule(ScriptContext * scriptContext, const byte * buffer, DWORD bufferBytes, WebAssemblyModule ** module);
+#endif
+
     private:
         static HRESULT DeserializeFromBufferInternal(ScriptContext * scriptContext, uint32 scriptFlags, LPCUTF8 utf8Source, ISourceHolder* sourceHolder, SRCINFO const * srcInfo, byte * buffer, NativeModule *nativeModule, Field(FunctionBody*)* function, uint sourceIndex = Js::Constants::InvalidSourceIndex);
     };
@@ -504,6 +504,8 @@ MACRO_BACKEND_ONLY(     LdWasmFunc,                 ElementSlot,    OpSideEffect
 
 MACRO_BACKEND_ONLY(     CheckWasmSignature,         Reg2,           OpSideEffect)
 MACRO_BACKEND_ONLY(     GrowWasmMemory,             Reg3,           OpSideEffect)
+MACRO_BACKEND_ONLY(     WasmMemoryCopy,             Reg2,           OpSideEffect)
+MACRO_BACKEND_ONLY(     WasmMemoryFill,             Reg2,           OpSideEffect)
 
 #ifndef FLOAT_VAR
 MACRO_BACKEND_ONLY(     StSlotBoxTemp,              Empty,          OpSideEffect|OpTempNumberSources)
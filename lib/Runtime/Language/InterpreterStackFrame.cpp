@@ -8202,6 +8202,26 @@ namespace Js
 #endif
     }
 
+    template <class T>
+    void InterpreterStackFrame::OP_MemoryCopy(const unaligned T* playout)
+    {
+#ifdef ENABLE_WASM
+        GetWebAssemblyMemory()->CopyInternal((uint32)GetRegRawInt(playout->I0), (uint32)GetRegRawInt(playout->I1), (uint32)GetRegRawInt(playout->I2));
+#else
+        Assert(UNREACHED);
+#endif
+    }
+
+    template <class T>
+    void InterpreterStackFrame::OP_MemoryFill(const unaligned T* playout)
+    {
+#ifdef ENABLE_WASM
+        GetWebAssemblyMemory()->FillInternal((uint32)GetRegRawInt(playout->I0), (uint32)GetRegRawInt(playout->I1), (uint32)GetRegRawInt(playout->I2));
+#else
+        Assert(UNREACHED);
+#endif
+    }
+
     template <typename T, InterpreterStackFrame::AsmJsMathPtr<T> func> T InterpreterStackFrame::OP_UnsignedDivRemCheck(T aLeft, T aRight, ScriptContext* scriptContext)
     {
         if (aRight == 0)
@@ -233,6 +233,8 @@ namespace Js
         void ValidateRegValue(Var value, bool allowStackVar = false, bool allowStackVarOnDisabledStackNestedFunc = true) const;
         int OP_GetMemorySize();
         int32 OP_GrowMemory(int32 delta);
+        template <class T> void OP_MemoryCopy(const unaligned T* playout);
+        template <class T> void OP_MemoryFill(const unaligned T* playout);
         void OP_Unreachable();
         template <typename T> using AsmJsMathPtr = T(*)(T a, T b);
         template <typename T, AsmJsMathPtr<T> func> static T OP_DivOverflow(T a, T b, ScriptContext* scriptContext);
@@ -72,18 +72,65 @@ namespace WAsmJs
         }
     }
 #endif
+#if ENABLE_NATIVE_CODEGEN
+    // WebAssembly functions go to the baseline JIT (the backend without global optimizations) on their first call instead
+    // of waiting in the interpreter. Prejitting still goes straight to the full JIT.
+    static bool ShouldBaselineJitFunction(Js::FunctionBody* body)
+    {
+        return CONFIG_FLAG(WasmBaselineJit) &&
+            body->IsWasmFunction() &&
+            !PHASE_OFF(Js::SimpleJitPhase, body) &&
+            CONFIG_FLAG(MaxAsmJsInterpreterRunCount) != 0 &&
+            !CONFIG_ISENABLED(Js::ForceNativeFlag);
+    }
+#endif
+
     void JitFunctionIfReady(Js::ScriptFunction* func, uint interpretedCount /*= 0*/)
     {
 #if ENABLE_NATIVE_CODEGEN
         Js::FunctionBody* body = func->GetFunctionBody();
         if (WAsmJs::ShouldJitFunction(body, interpretedCount))
         {
+            const bool baseline = ShouldBaselineJitFunction(body);
             if (PHASE_TRACE(Js::AsmjsEntryPointInfoPhase, body))
             {
-                Output::Print(_u("Scheduling %s For Full JIT at callcount:%d\n"), body->GetDisplayName(), interpretedCount);
+                Output::Print(_u("Scheduling %s For %s JIT at callcount:%d\n"), body->GetDisplayName(), baseline ? _u("Baseline") : _u("Full"), interpretedCount);
             }
             GenerateFunction(body->GetScriptContext()->GetNativeCodeGenerator(), body, func);
+            if (baseline)
+            {
+                body->SetIsWasmBaselineJitScheduled(true);
+            }
+            else
+            {
+                body->SetIsAsmJsFullJitScheduled(true);
+            }
+        }
+#endif
+    }
+
+    void TierUpFunction(Js::ScriptFunction* func)
+    {
+#if ENABLE_NATIVE_CODEGEN
+        Js::FunctionBody* body = func->GetFunctionBody();
+        Assert(body->GetIsWasmBaselineJitScheduled());
+        if (!body->GetIsAsmJsFullJitScheduled())
+        {
+            if (PHASE_TRACE(Js::AsmjsEntryPointInfoPhase, body))
+            {
+                Output::Print(_u("Scheduling %s For Full JIT from the baseline JIT code\n"), body->GetDisplayName());
+            }
+            // Until the full JIT is done, the new entry point falls back to the baseline code
+            GenerateFunction(body->GetScriptContext()->GetNativeCodeGenerator(), body, func);
             body->SetIsAsmJsFullJitScheduled(true);
+            return;
+        }
+
+        // The full JIT was scheduled through another function object of this body, switch this one over as well
+        Js::FunctionEntryPointInfo* defaultEntryPoint = body->GetDefaultFunctionEntryPointInfo();
+        if (func->GetFunctionEntryPointInfo() != defaultEntryPoint)
+        {
+            func->ChangeEntryPoint(defaultEntryPoint, defaultEntryPoint->jsMethod);
         }
 #endif
     }
@@ -94,7 +141,8 @@ namespace WAsmJs
         if (PHASE_OFF(Js::BackEndPhase, body) ||
             PHASE_OFF(Js::FullJitPhase, body) ||
             body->GetScriptContext()->GetConfig()->IsNoNative() ||
-            body->GetIsAsmJsFullJitScheduled())
+            body->GetIsAsmJsFullJitScheduled() ||
+            body->GetIsWasmBaselineJitScheduled()) // the baseline code schedules the full JIT once it is hot
         {
             return false;
         }
@@ -104,6 +152,10 @@ namespace WAsmJs
             return false;
         }
 #endif
+        if (ShouldBaselineJitFunction(body))
+        {
+            return true;
+        }
         const bool forceNative = CONFIG_ISENABLED(Js::ForceNativeFlag);
         const uint minAsmJsInterpretRunCount = (uint)CONFIG_FLAG(MinAsmJsInterpreterRunCount);
         const uint maxAsmJsInterpretRunCount = (uint)CONFIG_FLAG(MaxAsmJsInterpreterRunCount);
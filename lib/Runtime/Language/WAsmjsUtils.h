@@ -31,6 +31,7 @@ namespace WAsmJs
 #endif
     void JitFunctionIfReady(class Js::ScriptFunction* func, uint interpretedCount = 0);
     bool ShouldJitFunction(class Js::FunctionBody* body, uint interpretedCount = 0);
+    void TierUpFunction(class Js::ScriptFunction* func);
 
     typedef Js::RegSlot RegSlot;
 
@@ -7,6 +7,7 @@
 #include "WebAssemblySource.h"
 
 #ifdef ENABLE_WASM
+#include "WasmLimits.h"
 
 namespace Js
 {
@@ -84,5 +85,146 @@ void WebAssemblySource::CreateSourceInfo(bool createNewContext, ScriptContext* s
     scriptContext->SaveSourceNoCopy(sourceInfo, cchLength, /*isCesu8*/false);
 }
 
+WebAssemblySourceStream::WebAssemblySourceStream(BYTE* buffer, uint capacity) :
+    buffer(buffer), length(0), capacity(capacity), checkedLength(0), sectionEnd(0), sectionSize(0), sectionSizeShift(0), state(State::Header)
+{
+}
+
+WebAssemblySourceStream* WebAssemblySourceStream::New(uint expectedLength, ScriptContext* scriptContext)
+{
+    Recycler* recycler = scriptContext->GetRecycler();
+    // Don't trust the hint with a large allocation; the buffer grows as the bytes actually arrive
+    uint capacity = expectedLength > MaxInitialCapacity ? MaxInitialCapacity : expectedLength;
+    if (capacity < MinCapacity)
+    {
+        capacity = MinCapacity;
+    }
+    BYTE* buffer = RecyclerNewArrayLeaf(recycler, BYTE, capacity);
+    return RecyclerNew(recycler, WebAssemblySourceStream, buffer, capacity);
+}
+
+void WebAssemblySourceStream::Reserve(uint newLength, ScriptContext* scriptContext)
+{
+    if (newLength <= capacity)
+    {
+        return;
+    }
+
+    uint newCapacity = capacity > UINT_MAX / 2 || newLength > capacity * 2 ? newLength : capacity * 2;
+    BYTE* newBuffer = RecyclerNewArrayLeaf(scriptContext->GetRecycler(), BYTE, newCapacity);
+    js_memcpy_s(newBuffer, newCapacity, buffer, length);
+    buffer = newBuffer;
+    capacity = newCapacity;
+}
+
+void WebAssemblySourceStream::ThrowCompileError(ScriptContext* scriptContext, const char16* message)
+{
+    state = State::Failed;
+    JavascriptError::ThrowWebAssemblyCompileErrorVar(scriptContext, WASMERR_WasmCompileError, message);
+}
+
+void WebAssemblySourceStream::Append(const BYTE* bytes, uint byteCount, ScriptContext* scriptContext)
+{
+    Assert(!IsFailed());
+    Assert(bytes || byteCount == 0);
+
+    if (byteCount > Wasm::Limits::GetMaxModuleSize() - length)
+    {
+        ThrowCompileError(scriptContext, _u("Module too big"));
+    }
+
+    Reserve(length + byteCount, scriptContext);
+    js_memcpy_s(buffer + length, capacity - length, bytes, byteCount);
+    length += byteCount;
+
+    CheckFraming(scriptContext);
+}
+
+void WebAssemblySourceStream::CheckFraming(ScriptContext* scriptContext)
+{
+    while (checkedLength < length)
+    {
+        switch (state)
+        {
+        case State::Header:
+        {
+            // Matches the checks of WasmBinaryReader::InitializeReader, but a byte at a time, so that something
+            // that is not a module at all is rejected as soon as possible
+            static const BYTE header[HeaderLength] = { 0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00 };
+            const uint headerEnd = length < HeaderLength ? length : HeaderLength;
+            for (; checkedLength < headerEnd; checkedLength++)
+            {
+                if (buffer[checkedLength] == header[checkedLength])
+                {
+                    continue;
+                }
+                if (checkedLength < 4)
+                {
+                    ThrowCompileError(scriptContext, _u("Malformed WASM module header!"));
+                }
+                if (CONFIG_FLAG(WasmCheckVersion))
+                {
+                    ThrowCompileError(scriptContext, _u("Invalid WASM version!"));
+                }
+            }
+            if (checkedLength == HeaderLength)
+            {
+                state = State::SectionId;
+            }
+            break;
+        }
+
+        case State::SectionId:
+            // The reader rejects unknown section ids, and sections out of order, once the module is created
+            checkedLength++;
+            sectionSize = 0;
+            sectionSizeShift = 0;
+            state = State::SectionSize;
+            break;
+
+        case State::SectionSize:
+        {
+            BYTE b = buffer[checkedLength++];
+            if (sectionSizeShift == 28 && (b & 0xf0) != 0)
+            {
+                ThrowCompileError(scriptContext, _u("Invalid LEB128 format"));
+            }
+            sectionSize |= (uint32)(b & 0x7f) << sectionSizeShift;
+            sectionSizeShift += 7;
+            if ((b & 0x80) == 0)
+            {
+                if (sectionSize > Wasm::Limits::GetMaxModuleSize() - checkedLength)
+                {
+                    ThrowCompileError(scriptContext, _u("Section too big"));
+                }
+                sectionEnd = checkedLength + sectionSize;
+                state = State::SectionPayload;
+            }
+            break;
+        }
+
+        case State::SectionPayload:
+            if (length < sectionEnd)
+            {
+                checkedLength = length;
+                return;
+            }
+            checkedLength = sectionEnd;
+            state = State::SectionId;
+            break;
+
+        default:
+            Assume(UNREACHED);
+            return;
+        }
+    }
+
+    // A section may end exactly at the end of the bytes received so far
+    if (state == State::SectionPayload && checkedLength == sectionEnd)
+    {
+        state = State::SectionId;
+    }
+}
+
 }
 #endif
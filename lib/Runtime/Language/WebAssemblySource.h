@@ -25,5 +25,55 @@ namespace Js
         void ReadBufferSource(Var val, ScriptContext* scriptContext);
         void CreateSourceInfo(bool createNewContext, ScriptContext* scriptContext);
     };
+
+    // The bytes of a WebAssembly module, as a host receives them in chunks. The module header and the framing of each
+    // section are checked as the bytes arrive, so that a malformed module fails before all of it has been received.
+    // Chunks are copied once, into the buffer the module is eventually created from.
+    class WebAssemblySourceStream
+    {
+        enum class State : uint8
+        {
+            Header,             // magic number and version
+            SectionId,
+            SectionSize,        // LEB128, possibly split across chunks
+            SectionPayload,
+            Failed
+        };
+
+        static const uint HeaderLength = 8;
+        static const uint MinCapacity = 4096;
+        // The length is only a hint from the host, so at most this much is allocated up front
+        static const uint MaxInitialCapacity = 1024 * 1024;
+
+        Field(BYTE*) buffer;
+        Field(uint) length;
+        Field(uint) capacity;
+        // Offset of the first byte whose framing has not been checked yet
+        Field(uint) checkedLength;
+        // End of the current section, once its size has been read
+        Field(uint) sectionEnd;
+        Field(uint32) sectionSize;
+        Field(uint8) sectionSizeShift;
+        Field(State) state;
+
+        WebAssemblySourceStream(BYTE* buffer, uint capacity);
+
+        void Reserve(uint newLength, ScriptContext* scriptContext);
+        void CheckFraming(ScriptContext* scriptContext);
+        void __declspec(noreturn) ThrowCompileError(ScriptContext* scriptContext, const char16* message);
+
+    public:
+        // expectedLength is a hint for the size of the buffer, 0 if unknown
+        static WebAssemblySourceStream* New(uint expectedLength, ScriptContext* scriptContext);
+
+        // Throws a WebAssembly.CompileError, and fails the stream, if the bytes received so far cannot start a module
+        void Append(const BYTE* bytes, uint byteCount, ScriptContext* scriptContext);
+
+        bool IsFailed() const { return state == State::Failed; }
+        // False if the bytes received so far end inside the header or inside a section
+        bool IsAtModuleEnd() const { return state == State::SectionId; }
+        BYTE* GetBuffer() const { return buffer; }
+        uint GetLength() const { return length; }
+    };
 }
 #endif
@@ -4,6 +4,7 @@
 //-------------------------------------------------------------------------------------------------------
 #include "RuntimeLibraryPch.h"
 #include "JSONScanner.h"
+#include "Core/StringKernels.h"
 
 using namespace Js;
 
@@ -233,6 +234,15 @@ namespace JSON
 
         while (currentChar < inputText + inputLen)
         {
+            // Skip the run of characters that need no unescaping in one step
+            const char16* specialChar = StringKernels::FindJsonStringSpecialChar(currentChar, inputText + inputLen);
+            bulkLength += (uint)(specialChar - currentChar);
+            currentChar = specialChar;
+            if (currentChar >= inputText + inputLen)
+            {
+                break;
+            }
+
             ch = ReadNextChar();
             int tempHex;
 
@@ -8,9 +8,41 @@
 namespace Js
 {
 
+void
+JSONStringBuilder::Flush(bool isLastChunk)
+{
+    // Only a streaming builder may run out of buffer space; the exact-size builder treats it as corruption
+    AssertOrFailFast(this->sink != nullptr);
+
+    charcount_t length = static_cast<charcount_t>(this->currentLocation - this->bufferStart);
+
+    // Don't split a surrogate pair across chunks, so each chunk can be transcoded on its own
+    const bool holdBackLastCharacter = !isLastChunk && length > 0 && utf8::IsHighSurrogateChar(this->bufferStart[length - 1]);
+    if (holdBackLastCharacter)
+    {
+        --length;
+    }
+
+    if (length > 0)
+    {
+        this->sink->Write(this->bufferStart, length);
+    }
+
+    this->currentLocation = this->bufferStart;
+    if (holdBackLastCharacter)
+    {
+        *this->currentLocation = this->bufferStart[length];
+        ++this->currentLocation;
+    }
+}
+
 void
 JSONStringBuilder::AppendCharacter(char16 character)
 {
+    if (this->currentLocation >= endLocation)
+    {
+        this->Flush(false);
+    }
     AssertOrFailFast(this->currentLocation < endLocation);
     *this->currentLocation = character;
     ++this->currentLocation;
@@ -19,6 +51,15 @@ JSONStringBuilder::AppendCharacter(char16 character)
 void
 JSONStringBuilder::AppendBuffer(_In_ const char16* buffer, charcount_t length)
 {
+    while (this->sink != nullptr && this->currentLocation + length > endLocation)
+    {
+        const charcount_t available = static_cast<charcount_t>(endLocation - this->currentLocation);
+        wmemcpy_s(this->currentLocation, available, buffer, available);
+        this->currentLocation += available;
+        buffer += available;
+        length -= available;
+        this->Flush(false);
+    }
     AssertOrFailFast(this->currentLocation + length <= endLocation);
     wmemcpy_s(this->currentLocation, length, buffer, length);
     this->currentLocation += length;
@@ -286,6 +327,12 @@ void
 JSONStringBuilder::Build()
 {
     this->AppendJSONPropertyString(this->jsonContent);
+    if (this->sink != nullptr)
+    {
+        this->Flush(true);
+        return;
+    }
+
     // Null terminate the string
     AssertOrFailFast(this->currentLocation == endLocation);
     *this->currentLocation = _u('\0');
@@ -299,13 +346,37 @@ JSONStringBuilder::JSONStringBuilder(
     _In_opt_ const char16* gap,
     charcount_t gapLength) :
         scriptContext(scriptContext),
+        bufferStart(buffer),
         endLocation(buffer + bufferLength - 1),
         currentLocation(buffer),
+        sink(nullptr),
+        jsonContent(jsonContent),
+        gap(gap),
+        gapLength(gapLength),
+        indentLevel(0)
+{
+}
+
+JSONStringBuilder::JSONStringBuilder(
+    _In_ ScriptContext* scriptContext,
+    _In_ JSONProperty* jsonContent,
+    _In_ JSONStringSink* sink,
+    _In_ char16* buffer,
+    charcount_t bufferLength,
+    _In_opt_ const char16* gap,
+    charcount_t gapLength) :
+        scriptContext(scriptContext),
+        bufferStart(buffer),
+        endLocation(buffer + bufferLength),
+        currentLocation(buffer),
+        sink(sink),
         jsonContent(jsonContent),
         gap(gap),
         gapLength(gapLength),
         indentLevel(0)
 {
+    // Need room for at least a surrogate pair held back from the previous chunk plus one more character
+    AssertOrFailFast(bufferLength >= 2);
 }
 
 } //namespace Js
@@ -8,17 +8,29 @@
 namespace Js
 {
 
+// Receives the text built by JSONStringBuilder in chunks, for callers that stream the result
+// instead of materializing it as a single string
+class JSONStringSink
+{
+public:
+    virtual ~JSONStringSink() {}
+    virtual void Write(_In_reads_(length) const char16* buffer, charcount_t length) = 0;
+};
+
 class JSONStringBuilder
 {
 private:
     ScriptContext* scriptContext;
+    char16* bufferStart;
     const char16* endLocation;
     char16* currentLocation;
+    JSONStringSink* sink;
     JSONProperty* jsonContent;
     const char16* gap;
     charcount_t gapLength;
     uint32 indentLevel;
 
+    void Flush(bool isLastChunk);
     void AppendGap(uint32 count);
     void AppendCharacter(char16 character);
     void AppendBuffer(_In_ const char16* buffer, charcount_t length);
@@ -36,6 +48,17 @@ class JSONStringBuilder
         charcount_t bufferLength,
         _In_opt_ const char16* gap,
         charcount_t gapLength);
+
+    // Builds into the buffer and hands it to the sink whenever it fills up, so the buffer only
+    // needs to hold one chunk of the result
+    JSONStringBuilder(
+        _In_ ScriptContext* scriptContext,
+        _In_ JSONProperty* jsonContent,
+        _In_ JSONStringSink* sink,
+        _In_ char16* buffer,
+        charcount_t bufferLength,
+        _In_opt_ const char16* gap,
+        charcount_t gapLength);
     void Build();
 };
 
@@ -6720,13 +6720,161 @@ using namespace Js;
         }
     }
 
+    // Merges the sorted runs [start, middle) and [middle, end). Only the left run is copied to scratch. Items from
+    // the right run are taken only when strictly smaller, so equal items keep their order.
+    template <typename T>
+    static void StableSortMerge(T* elements, uint32 start, uint32 middle, uint32 end, T* scratch,
+        int (__cdecl *compare)(void*, const void*, const void*), void* context)
+    {
+        // The runs are often already in order (sorted or nearly sorted input); one comparison settles that.
+        if (compare(context, elements + middle - 1, elements + middle) <= 0)
+        {
+            return;
+        }
+
+        const uint32 leftLength = middle - start;
+        for (uint32 i = 0; i < leftLength; i++)
+        {
+            scratch[i] = elements[start + i];
+        }
+
+        uint32 left = 0;
+        uint32 right = middle;
+        uint32 dest = start;
+        TryFinally([&]()
+        {
+            while (left < leftLength && right < end)
+            {
+                if (compare(context, elements + right, scratch + left) < 0)
+                {
+                    elements[dest++] = elements[right++];
+                }
+                else
+                {
+                    elements[dest++] = scratch[left++];
+                }
+            }
+        },
+        [&](bool)
+        {
+            // The rest of the left run fills the gap in front of the unmerged part of the right run. Doing this
+            // when the comparer throws too keeps the elements a permutation of the input.
+            while (left < leftLength)
+            {
+                elements[dest++] = scratch[left++];
+            }
+        });
+    }
+
+    // Stable sort: runs of StableSortRunLength items are sorted with binary insertion sort and then merged bottom-up.
+    // scratch must hold length items.
+    template <typename T>
+    static void StableSort(__inout_ecount(length) T* elements, uint32 length, __inout_ecount(length) T* scratch,
+        int (__cdecl *compare)(void*, const void*, const void*), void* context)
+    {
+        const uint32 StableSortRunLength = 32;
+
+        for (uint32 runStart = 0; runStart < length; runStart += StableSortRunLength)
+        {
+            const uint32 runEnd = min(runStart + StableSortRunLength, length);
+            for (uint32 i = runStart + 1; i < runEnd; i++)
+            {
+                if (compare(context, elements + i, elements + i - 1) >= 0)
+                {
+                    continue;
+                }
+
+                // binary search for the left-most element greater than value:
+                uint32 first = runStart;
+                uint32 last = i - 1;
+                while (first < last)
+                {
+                    uint32 middle = first + (last - first) / 2;
+                    if (compare(context, elements + i, elements + middle) < 0)
+                    {
+                        last = middle;
+                    }
+                    else
+                    {
+                        first = middle + 1;
+                    }
+                }
+
+                // insert value right before first:
+                T value = elements[i];
+                for (uint32 j = i; j > first; j--)
+                {
+                    elements[j] = elements[j - 1];
+                }
+                elements[first] = value;
+            }
+        }
+
+        for (uint32 width = StableSortRunLength; width < length; width *= 2)
+        {
+            uint32 start = 0;
+            while (length - start > width)
+            {
+                const uint32 middle = start + width;
+                const uint32 end = length - middle > width ? middle + width : length;
+                StableSortMerge(elements, start, middle, end, scratch, compare, context);
+                if (end == length)
+                {
+                    break;
+                }
+                start = end;
+            }
+
+            if (width > UINT_MAX / 2)
+            {
+                break;
+            }
+        }
+    }
+
+    // Orders two int32 values the way the default comparer orders their decimal strings, without creating the strings.
+    static int __cdecl CompareInt32AsStrings(void*, const void* aRef, const void* bRef)
+    {
+        const int32 a = *static_cast<const int32*>(aRef);
+        const int32 b = *static_cast<const int32*>(bRef);
+        if (a == b)
+        {
+            return 0;
+        }
+
+        // '-' sorts before every digit; when both are negative the signs match and the magnitudes decide.
+        if ((a < 0) != (b < 0))
+        {
+            return a < 0 ? -1 : 1;
+        }
+
+        uint64 aMagnitude = a < 0 ? 0u - static_cast<uint32>(a) : static_cast<uint32>(a);
+        uint64 bMagnitude = b < 0 ? 0u - static_cast<uint32>(b) : static_cast<uint32>(b);
+        uint32 aDigits = 1, bDigits = 1;
+        for (uint64 v = aMagnitude; v >= 10; v /= 10) aDigits++;
+        for (uint64 v = bMagnitude; v >= 10; v /= 10) bDigits++;
+
+        // Pad the shorter number with zeros on the right so both have the same number of digits. If they are then
+        // equal, the shorter string is a prefix of the other and sorts first.
+        int tieBreak = 0;
+        for (; aDigits < bDigits; aDigits++) { aMagnitude *= 10; tieBreak = -1; }
+        for (; bDigits < aDigits; bDigits++) { bMagnitude *= 10; tieBreak = 1; }
+
+        if (aMagnitude != bMagnitude)
+        {
+            return aMagnitude < bMagnitude ? -1 : 1;
+        }
+        return tieBreak;
+    }
+
     static void hybridSort(__inout_ecount(length) Field(Var) *elements, uint32 length, CompareVarsInfo* compareInfo)
     {
         // The cost of memory moves starts to be more expensive than additional comparer calls (given a simple comparer)
         // for arrays of more than 512 elements.
         if (length > 512)
         {
-            qsort_s(elements, length, compareVars, compareInfo);
+            Field(Var) *scratch = RecyclerNewArray(compareInfo->scriptContext->GetRecycler(), Field(Var), length);
+            StableSort(elements, length, scratch, compareVars, compareInfo);
             return;
         }
 
@@ -7009,8 +7157,9 @@ using namespace Js;
 
     void JavascriptArray::SortElements(Element* elements, uint32 left, uint32 right)
     {
-        // Note: use write barrier policy of Field(Var)
-        qsort_s<Element, Field(Var)>(elements, right - left + 1, CompareElements, this);
+        const uint32 count = right - left + 1;
+        Element *scratch = RecyclerNewArrayZ(this->GetScriptContext()->GetRecycler(), Element, count);
+        StableSort(elements + left, count, scratch, CompareElements, this);
     }
 
     Var JavascriptArray::EntrySort(RecyclableObject* function, CallInfo callInfo, ...)
@@ -7075,6 +7224,22 @@ using namespace Js;
                 Js::Throw::FatalInternalError();
             }
 
+            // Without a comparer, an int array held in one full segment is sorted on the raw int32 values, ordered by
+            // their decimal strings. This avoids converting the array to Vars and creating a string per element.
+            if (compFn == nullptr
+                && arr->GetTypeId() == TypeIds_NativeIntArray
+                && !CONFIG_FLAG(StrongArraySort)
+                && arr->head->next == nullptr
+                && arr->head->left == 0
+                && arr->head->length == length
+                && arr->HasNoMissingValues())
+            {
+                SparseArraySegment<int32> *head = SparseArraySegment<int32>::From(arr->head);
+                int32 *scratch = RecyclerNewArrayLeaf(scriptContext->GetRecycler(), int32, length);
+                StableSort(head->elements, length, scratch, CompareInt32AsStrings, nullptr);
+                return args[0];
+            }
+
             EnsureNonNativeArray(arr);
             JS_REENTRANT(jsReentLock, arr->Sort(compFn));
         }
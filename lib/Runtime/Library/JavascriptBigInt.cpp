@@ -556,18 +556,54 @@ namespace Js
         }
     }
 
-    // return |pbi1| * |pbi2|
-    JavascriptBigInt * JavascriptBigInt::MulAbsolute(JavascriptBigInt * pbi1, JavascriptBigInt * pbi2)
+    // x += y, assume xLength >= yLength; return the carry out of x
+    digit_t JavascriptBigInt::AddDigitsInPlace(digit_t * x, digit_t xLength, const digit_t * y, digit_t yLength)
     {
-        // Start with maximum length possible in pbi3
-        digit_t length = pbi1->m_length + pbi2->m_length;
-        if (SIZE_MAX / sizeof(digit_t) < length) // overflow 
+        Assert(xLength >= yLength);
+        digit_t carryDigit = 0;
+        digit_t i = 0;
+        for (; i < yLength; i++)
         {
-            JavascriptError::ThrowRangeError(pbi1->GetScriptContext(), VBSERR_TypeMismatch, _u("Multiply BigInt"));
+            digit_t tempCarryDigit = 0;
+            x[i] = JavascriptBigInt::AddDigit(x[i], y[i], &tempCarryDigit);
+            x[i] = JavascriptBigInt::AddDigit(x[i], carryDigit, &tempCarryDigit);
+            carryDigit = tempCarryDigit;
+        }
+        for (; i < xLength && carryDigit > 0; i++)
+        {
+            digit_t tempCarryDigit = 0;
+            x[i] = JavascriptBigInt::AddDigit(x[i], carryDigit, &tempCarryDigit);
+            carryDigit = tempCarryDigit;
         }
-        JavascriptBigInt * pbi3 = JavascriptBigInt::CreateZeroWithLength(length, pbi1->GetScriptContext());
+        return carryDigit;
+    }
 
-        // Compute pbi3 = pbi1 * pbi2 as follow:
+    // x -= y, assume xLength >= yLength; return the borrow out of x
+    digit_t JavascriptBigInt::SubDigitsInPlace(digit_t * x, digit_t xLength, const digit_t * y, digit_t yLength)
+    {
+        Assert(xLength >= yLength);
+        digit_t borrowDigit = 0;
+        digit_t i = 0;
+        for (; i < yLength; i++)
+        {
+            digit_t tempBorrowDigit = 0;
+            x[i] = JavascriptBigInt::SubDigit(x[i], y[i], &tempBorrowDigit);
+            x[i] = JavascriptBigInt::SubDigit(x[i], borrowDigit, &tempBorrowDigit);
+            borrowDigit = tempBorrowDigit;
+        }
+        for (; i < xLength && borrowDigit > 0; i++)
+        {
+            digit_t tempBorrowDigit = 0;
+            x[i] = JavascriptBigInt::SubDigit(x[i], borrowDigit, &tempBorrowDigit);
+            borrowDigit = tempBorrowDigit;
+        }
+        return borrowDigit;
+    }
+
+    // result = a * b, assume result has aLength + bLength digits, all zero
+    void JavascriptBigInt::MulDigitsSchoolbook(const digit_t * a, digit_t aLength, const digit_t * b, digit_t bLength, digit_t * result)
+    {
+        // Compute result = a * b as follow:
         // e.g. A1 A0 * B1 B0 = C3 C2 C1 C0
         // C0 = A0 * B0 (take the digit and carry)
         // C1 = carry + A0 * B1 + A1 * B0 (take the digit and carry)
@@ -576,17 +612,17 @@ namespace Js
         digit_t carryDigit = 0;
         digit_t i3 = 0;
 
-        for (digit_t i1 = 0; i1 < pbi1->m_length; i1++)
+        for (digit_t i1 = 0; i1 < aLength; i1++)
         {
             carryDigit = 0;
-            for (digit_t i2 = 0; i2 < pbi2->m_length; i2++)
+            for (digit_t i2 = 0; i2 < bLength; i2++)
             {
                 i3 = i1 + i2;
                 digit_t tempCarryDigit1 = 0;
                 digit_t tempCarryDigit2 = 0;
-                pbi3->m_digits[i3] = JavascriptBigInt::AddDigit(pbi3->m_digits[i3], carryDigit, &tempCarryDigit1);
-                digit_t mulDigitResult = JavascriptBigInt::MulDigit(pbi1->m_digits[i1], pbi2->m_digits[i2], &carryDigit);
-                pbi3->m_digits[i3] = JavascriptBigInt::AddDigit(pbi3->m_digits[i3], mulDigitResult, &tempCarryDigit2);
+                result[i3] = JavascriptBigInt::AddDigit(result[i3], carryDigit, &tempCarryDigit1);
+                digit_t mulDigitResult = JavascriptBigInt::MulDigit(a[i1], b[i2], &carryDigit);
+                result[i3] = JavascriptBigInt::AddDigit(result[i3], mulDigitResult, &tempCarryDigit2);
                 digit_t overflow = 0;
                 carryDigit = JavascriptBigInt::AddDigit(carryDigit, tempCarryDigit1, &overflow);
                 Assert(overflow == 0); // [i1] * [i2] can not carry through [i1+i2+2]
@@ -595,10 +631,114 @@ namespace Js
             }
             if (carryDigit > 0)
             {
-                pbi3->m_digits[i3 + 1] = carryDigit;
+                result[i3 + 1] = carryDigit;
+            }
+        }
+    }
+
+    // result = a * b. result has aLength + bLength digits and must not overlap the inputs or scratch.
+    // Large operands use Karatsuba: with a = a1 * B^m + a0 and b = b1 * B^m + b0,
+    // a * b = z2 * B^2m + z1 * B^m + z0 where z0 = a0 * b0, z2 = a1 * b1 and z1 = (a0 + a1) * (b0 + b1) - z0 - z2,
+    // which takes three half size multiplications instead of four.
+    void JavascriptBigInt::MulDigits(const digit_t * a, digit_t aLength, const digit_t * b, digit_t bLength, digit_t * result, digit_t * scratch, digit_t scratchLength)
+    {
+        if (aLength < bLength)
+        {
+            const digit_t * tempDigits = a; a = b; b = tempDigits;
+            digit_t tempLength = aLength; aLength = bLength; bLength = tempLength;
+        }
+
+        if (bLength < KaratsubaThreshold)
+        {
+            memset(result, 0, (aLength + bLength) * sizeof(digit_t));
+            JavascriptBigInt::MulDigitsSchoolbook(a, aLength, b, bLength, result);
+            return;
+        }
+
+        const digit_t m = (aLength + 1) / 2;
+        if (bLength <= m)
+        {
+            // Unbalanced: multiply b by bLength sized slices of a, adding up the partial products
+            AssertOrFailFast(scratchLength >= 2 * bLength);
+            digit_t * partial = scratch;
+            memset(result, 0, (aLength + bLength) * sizeof(digit_t));
+            for (digit_t offset = 0; offset < aLength; offset += bLength)
+            {
+                digit_t sliceLength = min(bLength, aLength - offset);
+                JavascriptBigInt::MulDigits(a + offset, sliceLength, b, bLength, partial, scratch + 2 * bLength, scratchLength - 2 * bLength);
+                digit_t carryDigit = JavascriptBigInt::AddDigitsInPlace(result + offset, aLength + bLength - offset, partial, sliceLength + bLength);
+                AssertOrFailFast(carryDigit == 0);
             }
+            return;
+        }
+
+        const digit_t a1Length = aLength - m;
+        const digit_t b1Length = bLength - m;
+
+        // z0 and z2 go straight into the low and high parts of the result
+        JavascriptBigInt::MulDigits(a, m, b, m, result, scratch, scratchLength);
+        JavascriptBigInt::MulDigits(a + m, a1Length, b + m, b1Length, result + 2 * m, scratch, scratchLength);
+
+        AssertOrFailFast(scratchLength >= 4 * m + 4);
+        digit_t * aSum = scratch;
+        digit_t * bSum = scratch + m + 1;
+        digit_t * z1 = scratch + 2 * m + 2;
+
+        js_memcpy_s(aSum, m * sizeof(digit_t), a, m * sizeof(digit_t));
+        aSum[m] = JavascriptBigInt::AddDigitsInPlace(aSum, m, a + m, a1Length);
+        js_memcpy_s(bSum, m * sizeof(digit_t), b, m * sizeof(digit_t));
+        bSum[m] = JavascriptBigInt::AddDigitsInPlace(bSum, m, b + m, b1Length);
+
+        JavascriptBigInt::MulDigits(aSum, m + 1, bSum, m + 1, z1, scratch + 4 * m + 4, scratchLength - (4 * m + 4));
+
+        digit_t z1Length = 2 * m + 2;
+        digit_t borrowDigit = JavascriptBigInt::SubDigitsInPlace(z1, z1Length, result, 2 * m);
+        borrowDigit += JavascriptBigInt::SubDigitsInPlace(z1, z1Length, result + 2 * m, a1Length + b1Length);
+        AssertOrFailFast(borrowDigit == 0);
+
+        // z1 = a0 * b1 + a1 * b0 < B^(aLength + 1), so it fits above B^m once its leading zeros are dropped
+        while (z1Length > 0 && z1[z1Length - 1] == 0)
+        {
+            z1Length--;
         }
-        
+        AssertOrFailFast(z1Length <= aLength + bLength - m);
+        digit_t carryDigit = JavascriptBigInt::AddDigitsInPlace(result + m, aLength + bLength - m, z1, z1Length);
+        AssertOrFailFast(carryDigit == 0);
+    }
+
+    // return |pbi1| * |pbi2|
+    JavascriptBigInt * JavascriptBigInt::MulAbsolute(JavascriptBigInt * pbi1, JavascriptBigInt * pbi2)
+    {
+        // Start with maximum length possible in pbi3
+        digit_t length = pbi1->m_length + pbi2->m_length;
+        if (SIZE_MAX / sizeof(digit_t) < length) // overflow 
+        {
+            JavascriptError::ThrowRangeError(pbi1->GetScriptContext(), VBSERR_TypeMismatch, _u("Multiply BigInt"));
+        }
+        ScriptContext * scriptContext = pbi1->GetScriptContext();
+        JavascriptBigInt * pbi3 = JavascriptBigInt::CreateZeroWithLength(length, scriptContext);
+
+        if (min(pbi1->m_length, pbi2->m_length) < KaratsubaThreshold)
+        {
+            JavascriptBigInt::MulDigitsSchoolbook(pbi1->m_digits, pbi1->m_length, pbi2->m_digits, pbi2->m_length, pbi3->m_digits);
+        }
+        else
+        {
+            // Each Karatsuba level needs about twice its operand length in scratch, plus a few digits, and the
+            // operands halve at every level.
+            if ((SIZE_MAX / sizeof(digit_t) - 1024) / 4 < length)
+            {
+                JavascriptError::ThrowRangeError(scriptContext, VBSERR_TypeMismatch, _u("Multiply BigInt"));
+            }
+            digit_t scratchLength = 4 * length + 1024;
+            BEGIN_TEMP_ALLOCATOR(tempAlloc, scriptContext, _u("BigIntMul"))
+            {
+                digit_t * scratch = AnewArray(tempAlloc, digit_t, scratchLength);
+                JavascriptBigInt::MulDigits(pbi1->m_digits, pbi1->m_length, pbi2->m_digits, pbi2->m_length, pbi3->m_digits, scratch, scratchLength);
+            }
+            END_TEMP_ALLOCATOR(tempAlloc, scriptContext);
+        }
+
         // adjust length
         while ((pbi3->m_length > 0) && (pbi3->m_digits[pbi3->m_length - 1] == 0))
         {
@@ -16,6 +16,7 @@ namespace Js
         Field(bool) m_isNegative;
 
         static const digit_t InitDigitLength = 2;  // Max Digit length 
+        static const digit_t KaratsubaThreshold = 32;  // Operands with fewer digits are multiplied with the schoolbook method
 
         DEFINE_VTABLE_CTOR(JavascriptBigInt, RecyclableObject);
 
@@ -85,6 +86,10 @@ namespace Js
         static void SubAbsolute(JavascriptBigInt * pbi1, JavascriptBigInt * pbi2);
         static JavascriptBigInt * Mul(JavascriptBigInt * pbi1, JavascriptBigInt * pbi2);
         static JavascriptBigInt * MulAbsolute(JavascriptBigInt * pbi1, JavascriptBigInt * pbi2);
+        static void MulDigits(const digit_t * a, digit_t aLength, const digit_t * b, digit_t bLength, digit_t * result, digit_t * scratch, digit_t scratchLength);
+        static void MulDigitsSchoolbook(const digit_t * a, digit_t aLength, const digit_t * b, digit_t bLength, digit_t * result);
+        static digit_t AddDigitsInPlace(digit_t * x, digit_t xLength, const digit_t * y, digit_t yLength);
+        static digit_t SubDigitsInPlace(digit_t * x, digit_t xLength, const digit_t * y, digit_t yLength);
         int Compare(JavascriptBigInt * pbi);
         int CompareAbsolute(JavascriptBigInt * pbi);
         static BOOL Equals(JavascriptBigInt* left, Var right, BOOL* value, ScriptContext * requestContext);
@@ -132,8 +132,6 @@ namespace Js
         InitializeStaticValues();
         PrecalculateArrayAllocationBuckets();
 
-        this->cache.toStringTagCache = ScriptContextPolymorphicInlineCache::New(32, this);
-
 #if ENABLE_COPYONACCESS_ARRAY
         if (!PHASE_OFF1(CopyOnAccessArrayPhase))
         {
@@ -927,6 +925,17 @@ namespace Js
         JavascriptArray::EnsureCalculationOfAllocationBuckets<Js::JavascriptArray>();
     }
 
+    PolymorphicInlineCache * JavascriptLibrary::EnsureToStringTagCache()
+    {
+        // Created on first use rather than during library initialization, since many script contexts
+        // never call Object.prototype.toString on an object that could have a @@toStringTag.
+        if (this->cache.toStringTagCache == nullptr)
+        {
+            this->cache.toStringTagCache = ScriptContextPolymorphicInlineCache::New(32, this);
+        }
+        return this->cache.toStringTagCache;
+    }
+
     template<bool addPrototype, bool addName, bool useLengthType, bool addLength>
     bool JavascriptLibrary::InitializeFunction(DynamicObject *instance, DeferredTypeHandlerBase * typeHandler, DeferredInitializeMode mode)
     {
@@ -327,7 +327,7 @@ JavascriptMap::Clear()
 {
     JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
 
-    list.Clear();
+    list.Clear(this->GetRecycler());
 
     switch (this->kind)
     {
@@ -350,15 +350,15 @@ JavascriptMap::DeleteFromVarMap(Var value)
 {
     Assert(this->kind == (isComplex ? MapKind::ComplexVarMap : MapKind::SimpleVarMap));
 
-    MapDataNode * node = nullptr;
+    uint32 index = 0;
     if (isComplex
-        ? !this->u.complexVarMap->TryGetValueAndRemove(value, &node)
-        : !this->u.simpleVarMap->TryGetValueAndRemove(value, &node))
+        ? !this->u.complexVarMap->TryGetValueAndRemove(value, &index)
+        : !this->u.simpleVarMap->TryGetValueAndRemove(value, &index))
     {
         return false;
     }
 
-    this->list.Remove(node);
+    this->list.Remove(index);
     return true;
 }
 
@@ -409,10 +409,10 @@ JavascriptMap::Get(Var key, Var* value)
     case MapKind::SimpleVarMap:
     {
         // First check if the key is in the map
-        MapDataNode* node = nullptr;
-        if (this->u.simpleVarMap->TryGetValue(key, &node))
+        uint32 index = 0;
+        if (this->u.simpleVarMap->TryGetValue(key, &index))
         {
-            *value = node->data.Value();
+            *value = this->list.Item(index).Value();
             return true;
         }
         // If the key isn't in the map, check if the canonical value is
@@ -423,21 +423,21 @@ JavascriptMap::Get(Var key, Var* value)
             return false;
         }
 
-        if (!this->u.simpleVarMap->TryGetValue(simpleVar, &node))
+        if (!this->u.simpleVarMap->TryGetValue(simpleVar, &index))
         {
             return false;
         }
-        *value = node->data.Value();
+        *value = this->list.Item(index).Value();
         return true;
     }
     case MapKind::ComplexVarMap:
     {
-        MapDataNode * node = nullptr;
-        if (!this->u.complexVarMap->TryGetValue(key, &node))
+        uint32 index = 0;
+        if (!this->u.complexVarMap->TryGetValue(key, &index))
         {
             return false;
         }
-        *value = node->data.Value();
+        *value = this->list.Item(index).Value();
         return true;
     }
     default:
@@ -491,17 +491,35 @@ JavascriptMap::PromoteToComplexVarMap()
     uint newMapSize = this->u.simpleVarMap->Count() + 1;
     ComplexVarDataMap* newMap = RecyclerNew(this->GetRecycler(), ComplexVarDataMap, this->GetRecycler(), newMapSize);
 
-    JavascriptMap::MapDataList::Iterator iter = this->list.GetIterator();
-    // TODO: we can use a more efficient Iterator, since we know there will be no side effects
-    while (iter.Next())
+    this->list.Map([&](uint32 index, const MapDataKeyValuePair& pair)
     {
-        newMap->Add(iter.Current().Key(), iter.CurrentNode());
-    }
+        newMap->Add(pair.Key(), index);
+    });
 
     this->kind = MapKind::ComplexVarMap;
     this->u.complexVarMap = newMap;
 }
 
+uint32
+JavascriptMap::AppendToList(const MapDataKeyValuePair& pair)
+{
+    return this->list.Append(pair, this->GetRecycler(), [&](const MapDataKeyValuePair& entry, uint32 newIndex)
+    {
+        // The list compacted away its holes, moving entries to new indices
+        switch (this->kind)
+        {
+        case MapKind::SimpleVarMap:
+            this->u.simpleVarMap->Item(entry.Key(), newIndex);
+            return;
+        case MapKind::ComplexVarMap:
+            this->u.complexVarMap->Item(entry.Key(), newIndex);
+            return;
+        default:
+            Assume(UNREACHED);
+        }
+    });
+}
+
 void
 JavascriptMap::SetOnEmptyMap(Var key, Var value)
 {
@@ -512,9 +530,9 @@ JavascriptMap::SetOnEmptyMap(Var key, Var value)
         SimpleVarDataMap* newSimpleMap = RecyclerNew(this->GetRecycler(), SimpleVarDataMap, this->GetRecycler());
         MapDataKeyValuePair simplePair(simpleVar, value);
 
-        MapDataNode* node = this->list.Append(simplePair, this->GetRecycler());
+        uint32 index = this->AppendToList(simplePair);
 
-        newSimpleMap->Add(simpleVar, node);
+        newSimpleMap->Add(simpleVar, index);
 
         this->u.simpleVarMap = newSimpleMap;
         this->kind = MapKind::SimpleVarMap;
@@ -524,9 +542,9 @@ JavascriptMap::SetOnEmptyMap(Var key, Var value)
     ComplexVarDataMap* newComplexSet = RecyclerNew(this->GetRecycler(), ComplexVarDataMap, this->GetRecycler());
     MapDataKeyValuePair complexPair(key, value);
 
-    MapDataNode* node = this->list.Append(complexPair, this->GetRecycler());
+    uint32 index = this->AppendToList(complexPair);
 
-    newComplexSet->Add(key, node);
+    newComplexSet->Add(key, index);
 
     this->u.complexVarMap = newComplexSet;
     this->kind = MapKind::ComplexVarMap;
@@ -543,16 +561,16 @@ JavascriptMap::TrySetOnSimpleVarMap(Var key, Var value)
         return false;
     }
 
-    MapDataNode* node = nullptr;
-    if (this->u.simpleVarMap->TryGetValue(simpleVar, &node))
+    uint32 index = 0;
+    if (this->u.simpleVarMap->TryGetValue(simpleVar, &index))
     {
-        node->data = MapDataKeyValuePair(simpleVar, value);
+        this->list.SetItem(index, MapDataKeyValuePair(simpleVar, value));
         return true;
     }
 
     MapDataKeyValuePair pair(simpleVar, value);
-    MapDataNode* newNode = this->list.Append(pair, this->GetRecycler());
-    this->u.simpleVarMap->Add(simpleVar, newNode);
+    uint32 newIndex = this->AppendToList(pair);
+    this->u.simpleVarMap->Add(simpleVar, newIndex);
     return true;
 }
 
@@ -561,16 +579,16 @@ JavascriptMap::SetOnComplexVarMap(Var key, Var value)
 {
     Assert(this->kind == MapKind::ComplexVarMap);
 
-    MapDataNode* node = nullptr;
-    if (this->u.complexVarMap->TryGetValue(key, &node))
+    uint32 index = 0;
+    if (this->u.complexVarMap->TryGetValue(key, &index))
     {
-        node->data = MapDataKeyValuePair(key, value);
+        this->list.SetItem(index, MapDataKeyValuePair(key, value));
         return;
     }
 
     MapDataKeyValuePair pair(key, value);
-    MapDataNode* newNode = this->list.Append(pair, this->GetRecycler());
-    this->u.complexVarMap->Add(key, newNode);
+    uint32 newIndex = this->AppendToList(pair);
+    this->u.complexVarMap->Add(key, newIndex);
 }
 
 void
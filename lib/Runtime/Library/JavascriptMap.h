@@ -10,10 +10,10 @@ namespace Js
     {
     public:
         typedef JsUtil::KeyValuePair<Field(Var), Field(Var)> MapDataKeyValuePair;
-        typedef MapOrSetDataNode<MapDataKeyValuePair> MapDataNode;
         typedef MapOrSetDataList<MapDataKeyValuePair> MapDataList;
-        typedef JsUtil::BaseDictionary<Var, MapDataNode*, Recycler> SimpleVarDataMap;
-        typedef JsUtil::BaseDictionary<Var, MapDataNode*, Recycler, PowerOf2SizePolicy, SameValueZeroComparer> ComplexVarDataMap;
+        // The maps go from key to the index of its entry in the list
+        typedef JsUtil::BaseDictionary<Var, uint32, Recycler> SimpleVarDataMap;
+        typedef JsUtil::BaseDictionary<Var, uint32, Recycler, PowerOf2SizePolicy, SameValueZeroComparer> ComplexVarDataMap;
 
     private:
         enum class MapKind : uint8
@@ -55,6 +55,8 @@ namespace Js
         void SetOnComplexVarMap(Var key, Var value);
 
         void PromoteToComplexVarMap();
+
+        uint32 AppendToList(const MapDataKeyValuePair& pair);
     public:
         JavascriptMap(DynamicType* type);
 
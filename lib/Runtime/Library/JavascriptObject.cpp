@@ -389,7 +389,7 @@ Var JavascriptObject::GetToStringTagValue(RecyclableObject *thisArg, ScriptConte
     }
 
     const PropertyId toStringTagId(PropertyIds::_symbolToStringTag);
-    PolymorphicInlineCache *cache = scriptContext->GetLibrary()->GetToStringTagCache();
+    PolymorphicInlineCache *cache = scriptContext->GetLibrary()->EnsureToStringTagCache();
     PropertyValueInfo info;
     // We don't allow cache resizing, at least for the moment: it's more work, and since there's only one
     // cache per script context, we can afford to create each cache with the maximum size.
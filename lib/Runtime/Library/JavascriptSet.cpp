@@ -274,15 +274,34 @@ JavascriptSet::CreateVarSetFromList(uint initialCapacity)
 {
     T* varSet = RecyclerNew(this->GetRecycler(), T, this->GetRecycler(), initialCapacity);
 
-    JavascriptSet::SetDataList::Iterator iter = this->list.GetIterator();
-    // TODO: we can use a more efficient Iterator, since we know there will be no side effects
-    while (iter.Next())
+    this->list.Map([&](uint32 index, Var value)
     {
-        varSet->Add(iter.Current(), iter.CurrentNode());
-    }
+        varSet->Add(value, index);
+    });
     return varSet;
 }
 
+uint32
+JavascriptSet::AppendToList(Var value)
+{
+    return this->list.Append(value, this->GetRecycler(), [&](Var entry, uint32 newIndex)
+    {
+        // The list compacted away its holes, moving entries to new indices. Int sets never have holes since
+        // deleting from them promotes them to var sets.
+        switch (this->kind)
+        {
+        case SetKind::SimpleVarSet:
+            this->u.simpleVarSet->Item(entry, newIndex);
+            return;
+        case SetKind::ComplexVarSet:
+            this->u.complexVarSet->Item(entry, newIndex);
+            return;
+        default:
+            Assume(UNREACHED);
+        }
+    });
+}
+
 void
 JavascriptSet::PromoteToSimpleVarSet()
 {
@@ -325,7 +344,7 @@ JavascriptSet::AddToEmptySet(Var value)
         BVSparse<Recycler>* newIntSet = RecyclerNew(this->GetRecycler(), BVSparse<Recycler>, this->GetRecycler());
         newIntSet->Set(intVal);
 
-        this->list.Append(taggedInt, this->GetRecycler());
+        this->AppendToList(taggedInt);
 
         this->u.intSet = newIntSet;
         this->kind = SetKind::IntSet;
@@ -336,9 +355,9 @@ JavascriptSet::AddToEmptySet(Var value)
     if (simpleVar)
     {
         SimpleVarDataSet* newSimpleSet = RecyclerNew(this->GetRecycler(), SimpleVarDataSet, this->GetRecycler());
-        SetDataNode* node = this->list.Append(simpleVar, this->GetRecycler());
+        uint32 index = this->AppendToList(simpleVar);
 
-        newSimpleSet->Add(simpleVar, node);
+        newSimpleSet->Add(simpleVar, index);
 
         this->u.simpleVarSet = newSimpleSet;
         this->kind = SetKind::SimpleVarSet;
@@ -346,9 +365,9 @@ JavascriptSet::AddToEmptySet(Var value)
     }
 
     ComplexVarDataSet* newComplexSet = RecyclerNew(this->GetRecycler(), ComplexVarDataSet, this->GetRecycler());
-    SetDataNode* node = this->list.Append(value, this->GetRecycler());
+    uint32 index = this->AppendToList(value);
 
-    newComplexSet->Add(value, node);
+    newComplexSet->Add(value, index);
 
     this->u.complexVarSet = newComplexSet;
     this->kind = SetKind::ComplexVarSet;
@@ -367,7 +386,7 @@ JavascriptSet::TryAddToIntSet(Var value)
     int32 intVal = TaggedInt::ToInt32(taggedInt);
     if (!this->u.intSet->TestAndSet(intVal))
     {
-        this->list.Append(taggedInt, this->GetRecycler());
+        this->AppendToList(taggedInt);
     }
     return true;
 }
@@ -384,8 +403,8 @@ JavascriptSet::TryAddToSimpleVarSet(Var value)
 
     if (!this->u.simpleVarSet->ContainsKey(simpleVar))
     {
-        SetDataNode* node = this->list.Append(simpleVar, this->GetRecycler());
-        this->u.simpleVarSet->Add(simpleVar, node);
+        uint32 index = this->AppendToList(simpleVar);
+        this->u.simpleVarSet->Add(simpleVar, index);
     }
 
     return true;
@@ -397,8 +416,8 @@ JavascriptSet::AddToComplexVarSet(Var value)
     Assert(this->kind == SetKind::ComplexVarSet);
     if (!this->u.complexVarSet->ContainsKey(value))
     {
-        SetDataNode* node = this->list.Append(value, this->GetRecycler());
-        this->u.complexVarSet->Add(value, node);
+        uint32 index = this->AppendToList(value);
+        this->u.complexVarSet->Add(value, index);
     }
 }
 
@@ -456,7 +475,7 @@ JavascriptSet::Add(Var value)
 void JavascriptSet::Clear()
 {
     JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
-    this->list.Clear();
+    this->list.Clear(this->GetRecycler());
     switch (this->kind)
     {
     case SetKind::EmptySet:
@@ -493,15 +512,15 @@ bool
 JavascriptSet::DeleteFromVarSet(Var value)
 {
     Assert(this->kind == (isComplex ? SetKind::ComplexVarSet : SetKind::SimpleVarSet));
-    SetDataNode * node = nullptr;
+    uint32 index = 0;
     if (isComplex
-        ? !this->u.complexVarSet->TryGetValueAndRemove(value, &node)
-        : !this->u.simpleVarSet->TryGetValueAndRemove(value, &node))
+        ? !this->u.complexVarSet->TryGetValueAndRemove(value, &index)
+        : !this->u.simpleVarSet->TryGetValueAndRemove(value, &index))
     {
         return false;
     }
 
-    this->list.Remove(node);
+    this->list.Remove(index);
     return true;
 }
 
@@ -531,7 +550,7 @@ bool JavascriptSet::Delete(Var value)
         {
             return false;
         }
-        // We don't have the list node pointer readily available, so deletion from int sets would require walking the list
+        // We don't have the list index readily available, so deletion from int sets would require walking the list
         // Because of this, let's just promote to a var set
         //
         // If this promotion becomes an issue, we can consider options to improve this, e.g. deferring until an iterator is requested
@@ -9,10 +9,10 @@ namespace Js
     class JavascriptSet : public DynamicObject
     {
     public:
-        typedef MapOrSetDataNode<Var> SetDataNode;
         typedef MapOrSetDataList<Var> SetDataList;
-        typedef JsUtil::BaseDictionary<Var, SetDataNode*, Recycler, PowerOf2SizePolicy, SameValueZeroComparer> ComplexVarDataSet;
-        typedef JsUtil::BaseDictionary<Var, SetDataNode*, Recycler> SimpleVarDataSet;
+        // The var sets go from value to the index of its entry in the list
+        typedef JsUtil::BaseDictionary<Var, uint32, Recycler, PowerOf2SizePolicy, SameValueZeroComparer> ComplexVarDataSet;
+        typedef JsUtil::BaseDictionary<Var, uint32, Recycler> SimpleVarDataSet;
 
     private:
         enum class SetKind : uint8
@@ -59,6 +59,8 @@ namespace Js
         void PromoteToSimpleVarSet();
         void PromoteToComplexVarSet();
 
+        uint32 AppendToList(Var value);
+
         void AddToEmptySet(Var value);
         bool TryAddToIntSet(Var value);
         bool TryAddToSimpleVarSet(Var value);
@@ -5,6 +5,7 @@
 #include "RuntimeLibraryPch.h"
 
 #include "DataStructures/BigUInt.h"
+#include "Core/StringKernels.h"
 #include "Library/EngineInterfaceObject.h"
 #include "Library/IntlEngineInterfaceExtensionObject.h"
 
@@ -343,6 +344,56 @@ namespace Js
         return str[index];
     }
 
+    bool JavascriptString::RangeEquals(charcount_t start, __in_ecount(length) const char16* buffer, charcount_t length)
+    {
+        AssertOrFailFast(start <= this->GetLength() && length <= this->GetLength() - start);
+        return this->RangeEqualsImpl(start, buffer, length, 0);
+    }
+
+    bool JavascriptString::RangeEqualsImpl(charcount_t start, __in_ecount(length) const char16* buffer, charcount_t length, const byte recursionDepth)
+    {
+        JavascriptString * const * items = nullptr;
+        const int itemCount = (this->IsFinalized() || !this->IsTree() || recursionDepth == MaxRangeEqualsRecursionDepth)
+            ? -1
+            : this->GetRandomAccessItemsFromConcatString(items);
+
+        if (itemCount < 0)
+        {
+            // A flat string, or a tree we can't walk (or too deep to keep walking), is compared as a flat buffer
+            return wmemcmp(this->GetString() + start, buffer, length) == 0;
+        }
+
+        for (int i = 0; i < itemCount && length != 0; i++)
+        {
+            JavascriptString * const item = items[i];
+            if (item == nullptr)
+            {
+                // ConcatStringN leaves the slots after the last item empty
+                break;
+            }
+
+            const charcount_t itemLength = item->GetLength();
+            if (start >= itemLength)
+            {
+                start -= itemLength;
+                continue;
+            }
+
+            const charcount_t count = min(itemLength - start, length);
+            if (!item->RangeEqualsImpl(start, buffer, count, recursionDepth + 1))
+            {
+                return false;
+            }
+
+            buffer += count;
+            length -= count;
+            start = 0;
+        }
+
+        Assert(length == 0);
+        return true;
+    }
+
     void JavascriptString::CopyHelper(__out_ecount(countNeeded) char16 *dst, __in_ecount(countNeeded) const char16 * str, charcount_t countNeeded)
     {
         switch(countNeeded)
@@ -1082,11 +1133,10 @@ namespace Js
             const char16* inputStr = pThis->GetString();
             if (searchLen == 1)
             {
-                int i = position;
-                for(; i < len && inputStr[i] != *searchStr ; i++);
-                if (i < len)
+                const char16* found = StringKernels::FindChar(inputStr + position, inputStr + len, *searchStr);
+                if (found < inputStr + len)
                 {
-                    result = i;
+                    result = (int)(found - inputStr);
                 }
             }
             else
@@ -2247,51 +2297,18 @@ namespace Js
 
         if (useInvariant)
         {
-            const char16 *pThisString = pThis->GetString();
-            bool isAscii = true;
-            for (charcount_t i = 0; i < pThisLength; i++)
+            // Invariant casing of ASCII is a fixed mapping. Look for a non-ASCII character before allocating, so that strings
+            // which need the linguistic conversion below don't pay for a buffer they can't use.
+            const char16 nonAsciiRange[] = { 0x80, 0xFFFF };
+            const char16 *const source = pThis->GetString();
+            if (StringKernels::FindCharInRanges(source, source + pThisLength, nonAsciiRange, 1, false) == source + pThisLength)
             {
-                if (pThisString[i] >= 0x80)
-                {
-                    isAscii = false;
-                    break;
-                }
-            }
-
-            if (isAscii)
-            {
-                char16 *ret = RecyclerNewArrayLeaf(scriptContext->GetRecycler(), char16, UInt32Math::Add(pThisLength, 1));
-                const char16 diffBetweenCases = 32;
-                for (charcount_t i = 0; i < pThisLength; i++)
-                {
-                    char16 cur = pThisString[i];
-                    if (toUpper)
-                    {
-                        if (cur >= _u('a') && cur <= _u('z'))
-                        {
-                            ret[i] = cur - diffBetweenCases;
-                        }
-                        else
-                        {
-                            ret[i] = cur;
-                        }
-                    }
-                    else
-                    {
-                        if (cur >= _u('A') && cur <= _u('Z'))
-                        {
-                            ret[i] = cur + diffBetweenCases;
-                        }
-                        else
-                        {
-                            ret[i] = cur;
-                        }
-                    }
-                }
-
-                ret[pThisLength] = 0;
+                char16 *const asciiBuffer = RecyclerNewArrayLeaf(scriptContext->GetRecycler(), char16, UInt32Math::Add(pThisLength, 1));
+                const bool isAscii = StringKernels::ChangeAsciiCase<toUpper>(asciiBuffer, source, pThisLength);
+                AssertOrFailFast(isAscii);
+                asciiBuffer[pThisLength] = 0;
 
-                return JavascriptString::NewWithBuffer(ret, pThisLength, scriptContext);
+                return JavascriptString::NewWithBuffer(asciiBuffer, pThisLength, scriptContext);
             }
         }
 
@@ -2590,7 +2607,7 @@ namespace Js
 
         GetThisAndSearchStringArguments(args, scriptContext, _u("String.prototype.startsWith"), &pThis, &pSearch, false);
 
-        const char16* thisStr = pThis->GetString();
+        // Compared with RangeEquals so that checking the start of a concat tree doesn't flatten it
         int thisStrLen = pThis->GetLength();
 
         const char16* searchStr = pSearch->GetString();
@@ -2613,7 +2630,7 @@ namespace Js
         if (startPosition <= thisStrLen - searchStrLen)
         {
             Assert(searchStrLen <= thisStrLen - startPosition);
-            if (wmemcmp(thisStr + startPosition, searchStr, searchStrLen) == 0)
+            if (pThis->RangeEquals(startPosition, searchStr, searchStrLen))
             {
                 return scriptContext->GetLibrary()->GetTrue();
             }
@@ -2645,7 +2662,7 @@ namespace Js
 
         GetThisAndSearchStringArguments(args, scriptContext, _u("String.prototype.endsWith"), &pThis, &pSearch, false);
 
-        const char16* thisStr = pThis->GetString();
+        // Compared with RangeEquals so that checking the end of a concat tree doesn't flatten it
         int thisStrLen = pThis->GetLength();
 
         const char16* searchStr = pSearch->GetString();
@@ -2668,7 +2685,7 @@ namespace Js
         {
             Assert(startPosition <= thisStrLen);
             Assert(searchStrLen <= thisStrLen - startPosition);
-            if (wmemcmp(thisStr + startPosition, searchStr, searchStrLen) == 0)
+            if (pThis->RangeEquals(startPosition, searchStr, searchStrLen))
             {
                 return scriptContext->GetLibrary()->GetTrue();
             }
@@ -3518,8 +3535,6 @@ namespace Js
 
     uint JavascriptString::strstr(JavascriptString *string, JavascriptString *substring, bool useBoyerMoore, uint start)
     {
-        uint i;
-
         const char16 *stringOrig = string->GetString();
         uint stringLenOrig = string->GetLength();
         const char16 *stringSz = stringOrig + start;
@@ -3552,15 +3567,18 @@ namespace Js
             {
                 return 0;
             }
-            for (i = 0; i <= stringLen - substringLen; i++)
+            const char16* const lastCandidate = stringSz + (stringLen - substringLen);
+            for (const char16* candidate = stringSz; candidate <= lastCandidate; candidate++)
             {
                 // Quick check for first character.
-                if (stringSz[i] == substringSz[0])
+                candidate = StringKernels::FindChar(candidate, lastCandidate + 1, substringSz[0]);
+                if (candidate > lastCandidate)
                 {
-                    if (substringLen == 1 || wmemcmp(stringSz + i + 1, substringSz + 1, (substringLen - 1)) == 0)
-                    {
-                        return i + start;
-                    }
+                    break;
+                }
+                if (substringLen == 1 || wmemcmp(candidate + 1, substringSz + 1, (substringLen - 1)) == 0)
+                {
+                    return (uint)(candidate - stringSz) + start;
                 }
             }
         }
@@ -47,12 +47,20 @@ namespace Js
     protected:
         static const byte MaxCopyRecursionDepth = 3;
 
+    private:
+        static const byte MaxRangeEqualsRecursionDepth = 32;
+        bool RangeEqualsImpl(charcount_t start, __in_ecount(length) const char16* buffer, charcount_t length, const byte recursionDepth);
+
     public:
 
         BOOL HasItemAt(charcount_t idxChar);
         BOOL GetItemAt(charcount_t idxChar, Var* value);
         char16 GetItem(charcount_t index);
 
+        // Compares [start, start + length) of this string with the buffer. An unflattened concat tree is
+        // walked in place rather than flattened, so checking a prefix of a large built-up string stays cheap.
+        bool RangeEquals(charcount_t start, __in_ecount(length) const char16* buffer, charcount_t length);
+
         virtual void GetPropertyRecord(_Out_ PropertyRecord const** propertyRecord, bool dontLookupFromDictionary = false);
         virtual void CachePropertyRecord(_In_ PropertyRecord const* propertyRecord);
 
@@ -205,6 +205,27 @@ LazyJSONString::GetSz()
     return target;
 }
 
+void
+LazyJSONString::WriteTo(_In_ JSONStringSink* sink, _In_reads_(bufferLength) char16* buffer, charcount_t bufferLength)
+{
+    if (this->IsFinalized())
+    {
+        sink->Write(this->UnsafeGetBuffer(), this->GetLength());
+        return;
+    }
+
+    JSONStringBuilder builder(
+        this->GetScriptContext(),
+        this->jsonContent,
+        sink,
+        buffer,
+        bufferLength,
+        this->gap,
+        this->gapLength);
+
+    builder.Build();
+}
+
 template <> bool VarIsImpl<LazyJSONString>(RecyclableObject* obj)
 {
     return VirtualTableInfo<LazyJSONString>::HasVirtualTable(obj);
@@ -7,6 +7,7 @@
 
 namespace Js
 {
+class JSONStringSink;
 struct JSONObjectProperty;
 struct JSONProperty;
 struct JSONArray;
@@ -105,6 +106,9 @@ class LazyJSONString : public JavascriptString
 
     const char16* GetSz() override sealed;
 
+    // Writes the string to the sink a buffer's worth at a time, without materializing the full string
+    void WriteTo(_In_ JSONStringSink* sink, _In_reads_(bufferLength) char16* buffer, charcount_t bufferLength);
+
     virtual VTableValue DummyVirtualFunctionToHinderLinkerICF()
     {
         return VTableValue::VtableLazyJSONString;
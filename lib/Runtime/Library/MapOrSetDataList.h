@@ -4,16 +4,22 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 
-// This is a special use doubly linked list whose iterators are always valid
-// no matter what modifications are made to the list during iteration. The
-// iterators rely on deleted nodes still having valid next and prev references
-// to the nodes they used to be next to before being removed. They also rely
-// on nodes being recycler allocated so that active iterators do not need to
-// be tracked by the list and updated when deletes occur. Finally, well
-// defined iteration order is maintained by only allowing new items to be
-// appended to the end of the list. This allows an iterator to validate
-// itself by seeking backwards until it finds a node whose previous's next
-// still points to it.
+// This is the insertion ordered entry storage of ES6 Map and Set objects. Entries
+// live in a dense array in insertion order and are referred to by index; the Map
+// or Set keeps its own key to index lookup table. Deleting an entry leaves a hole
+// which iteration skips. When the array is full it is either grown, keeping every
+// index as is, or, if at least half of it is holes, compacted into a new array.
+// Compaction moves entries, so the owner is called back with the new index of
+// every live entry.
+//
+// Iterators stay valid no matter what modifications are made during iteration.
+// An entry array is never written to again once it has been replaced. Instead it
+// records its successor and how its indices map onto the successor's (unchanged
+// after growth, shifted down past the holes after compaction, reset to the start
+// after a clear), so an iterator still positioned in a replaced array catches up
+// the next time it advances. Entry arrays are recycler allocated, so replaced ones
+// stay alive exactly as long as some iterator references them, and the list does
+// not need to track its active iterators.
 //
 // The intended use of this list is to track insertion order for items added
 // to ES6 Map and Set objects. If a more general use if found for this data
@@ -22,170 +28,277 @@
 namespace Js
 {
     template <typename TData>
-    class MapOrSetDataNode
+    class MapOrSetDataList
     {
+    public:
+        static const uint32 InitialCapacity = 8;
+
     private:
-        template <typename TData>
-        friend class MapOrSetDataList;
+        enum class ForwardKind : uint8
+        {
+            // The storage is current
+            None,
+            // Replaced by a larger copy; indices are unchanged
+            Grown,
+            // Replaced by a copy without the holes; indices shift down by the number of holes before them
+            Compacted,
+            // Replaced because the list was cleared; iteration restarts at the first entry of the successor
+            Cleared
+        };
 
-        Field(MapOrSetDataNode<TData>*) next;
-        Field(MapOrSetDataNode<TData>*) prev;
+        class Storage
+        {
+        public:
+            Field(Field(TData)*) entries;
+            Field(uint32) capacity;
+            // Number of entries used, including holes
+            Field(uint32) count;
+            Field(Storage*) next;
+            Field(ForwardKind) forwardKind;
 
-        MapOrSetDataNode(TData& data) : data(data), next(nullptr), prev(nullptr) { }
+            Storage(Field(TData)* entries, uint32 capacity) :
+                entries(entries), capacity(capacity), count(0), next(nullptr), forwardKind(ForwardKind::None)
+            {
+            }
 
-    public:
-        Field(TData) data;
-    };
+            static Storage* New(Recycler* recycler, uint32 capacity)
+            {
+                Field(TData)* entries = RecyclerNewArrayZ(recycler, Field(TData), capacity);
+                return RecyclerNew(recycler, Storage, entries, capacity);
+            }
 
-    template <typename TData>
-    class MapOrSetDataList
-    {
-    private:
-        Field(MapOrSetDataNode<TData>*) first;
-        Field(MapOrSetDataNode<TData>*) last;
+            void ForwardTo(Storage* successor, ForwardKind kind)
+            {
+                Assert(this->next == nullptr && kind != ForwardKind::None);
+                this->next = successor;
+                this->forwardKind = kind;
+            }
+
+            // Maps an index into this (replaced, and therefore frozen) storage to the index of the first entry at
+            // or after it in the successor.
+            uint32 TranslateIndex(uint32 index) const
+            {
+                switch (this->forwardKind)
+                {
+                case ForwardKind::Grown:
+                    return index;
+                case ForwardKind::Cleared:
+                    return 0;
+                case ForwardKind::Compacted:
+                {
+                    uint32 liveBefore = 0;
+                    for (uint32 i = 0; i < index; i++)
+                    {
+                        if (!IsHole(this->entries[i]))
+                        {
+                            liveBefore++;
+                        }
+                    }
+                    return liveBefore;
+                }
+                default:
+                    Assume(UNREACHED);
+                    return index;
+                }
+            }
+        };
+
+        Field(Storage*) storage;
+        Field(uint32) liveCount;
+
+        static bool IsHole(Var data)
+        {
+            return data == nullptr;
+        }
+
+        template <typename TKey, typename TValue>
+        static bool IsHole(const JsUtil::KeyValuePair<TKey, TValue>& data)
+        {
+            return data.Key() == nullptr;
+        }
+
+        static void SetHole(Field(Var)& data)
+        {
+            data = nullptr;
+        }
+
+        template <typename TKey, typename TValue>
+        static void SetHole(JsUtil::KeyValuePair<TKey, TValue>& data)
+        {
+            data = JsUtil::KeyValuePair<TKey, TValue>(nullptr, nullptr);
+        }
+
+        template <typename FReindex>
+        void Rebuild(Recycler* recycler, FReindex reindex)
+        {
+            Storage* oldStorage = this->storage;
+            Storage* newStorage;
+
+            if (oldStorage->count - this->liveCount < oldStorage->count / 2)
+            {
+                uint32 newCapacity = UInt32Math::Mul(oldStorage->capacity, 2);
+                newStorage = Storage::New(recycler, newCapacity);
+                for (uint32 i = 0; i < oldStorage->count; i++)
+                {
+                    newStorage->entries[i] = oldStorage->entries[i];
+                }
+                newStorage->count = oldStorage->count;
+                oldStorage->ForwardTo(newStorage, ForwardKind::Grown);
+            }
+            else
+            {
+                newStorage = Storage::New(recycler, oldStorage->capacity);
+                uint32 newCount = 0;
+                for (uint32 i = 0; i < oldStorage->count; i++)
+                {
+                    if (!IsHole(oldStorage->entries[i]))
+                    {
+                        newStorage->entries[newCount] = oldStorage->entries[i];
+                        reindex(newStorage->entries[newCount], newCount);
+                        newCount++;
+                    }
+                }
+                Assert(newCount == this->liveCount);
+                newStorage->count = newCount;
+                oldStorage->ForwardTo(newStorage, ForwardKind::Compacted);
+            }
+
+            this->storage = newStorage;
+        }
 
     public:
         MapOrSetDataList(VirtualTableInfoCtorEnum) {};
-        MapOrSetDataList() : first(nullptr), last(nullptr) { }
+        MapOrSetDataList() : storage(nullptr), liveCount(0) { }
 
         class Iterator
         {
             Field(MapOrSetDataList<TData>*) list;
-            Field(MapOrSetDataNode<TData>*) current;
+            Field(Storage*) storage;
+            // Index of the entry after the current one
+            Field(uint32) nextIndex;
         public:
-            Iterator() : list(nullptr), current(nullptr) { }
-            Iterator(MapOrSetDataList<TData>* list) : list(list), current(nullptr) { }
+            Iterator() : list(nullptr), storage(nullptr), nextIndex(0) { }
+            Iterator(MapOrSetDataList<TData>* list) : list(list), storage(list->storage), nextIndex(0) { }
 
             bool Next()
             {
-                // Nodes can be deleted while iterating so validate current
-                // and if it is not valid find last valid node by following
-                // previous toward first.
-                // Note: clear will simply null out first and last, but
-                // not invalidated nodes, so we must also check to see that
-                // first is not null
-
-                if (list == nullptr || list->first == nullptr)
+                if (list == nullptr)
                 {
-                    // list is empty or was cleared during enumeration
-                    list = nullptr;
-                    current = nullptr;
                     return false;
                 }
 
-                if (current)
+                if (storage == nullptr)
+                {
+                    // Nothing had been added to the list when the iterator was created
+                    storage = list->storage;
+                    nextIndex = 0;
+                }
+
+                if (storage != nullptr)
                 {
-                    while (current->prev && current->prev->next != current)
+                    // Catch up with growth, compaction and clears that happened since the last step
+                    while (storage->next != nullptr)
                     {
-                        current = current->prev;
+                        nextIndex = storage->TranslateIndex(nextIndex);
+                        storage = storage->next;
                     }
 
-                    if (current->prev == nullptr && current != list->first)
+                    while (nextIndex < storage->count)
                     {
-                        current = list->first;
-
-                        if (current != nullptr)
+                        if (!IsHole(storage->entries[nextIndex++]))
                         {
                             return true;
                         }
-
-                        list = nullptr;
-                        current = nullptr;
-                        return false;
-                    }
-
-                    if (current->next == nullptr && current != list->last)
-                    {
-                        Assert(list->last == nullptr);
-                        current = nullptr;
                     }
                 }
 
-                if (current != list->last)
-                {
-                    if (current == nullptr)
-                    {
-                        Assert(list->first != nullptr);
-                        current = list->first;
-                    }
-                    else
-                    {
-                        current = current->next;
-                    }
-                    return true;
-                }
-
                 list = nullptr;
-                current = nullptr;
+                storage = nullptr;
                 return false;
             }
 
-            const TData& Current() const
-            {
-                return current->data;
-            }
-
-            Field(MapOrSetDataNode<TData>*) CurrentNode() const
+            TData Current() const
             {
-                return current;
+                Assert(storage != nullptr && nextIndex != 0);
+                return storage->entries[nextIndex - 1];
             }
         };
 
-        void Clear()
+        uint32 Count() const
         {
-            first = nullptr;
-            last = nullptr;
+            return liveCount;
         }
 
-        MapOrSetDataNode<TData>* Append(TData& data, Recycler* recycler)
+        TData Item(uint32 index) const
         {
-            // Must allocate with the recycler so that iterators can continue
-            // to point to removed nodes.  That is, cannot delete nodes when
-            // they are removed.  Reference counting would also work.
-            MapOrSetDataNode<TData>* newNode = RecyclerNew(recycler, MapOrSetDataNode<TData>, data);
+            Assert(storage != nullptr && index < storage->count && !IsHole(storage->entries[index]));
+            return storage->entries[index];
+        }
 
-            if (last == nullptr)
-            {
-                Assert(first == nullptr);
-                first = newNode;
-                last = newNode;
-            }
-            else
+        void SetItem(uint32 index, const TData& data)
+        {
+            Assert(storage != nullptr && index < storage->count && !IsHole(storage->entries[index]));
+            Assert(!IsHole(data));
+            storage->entries[index] = data;
+        }
+
+        void Clear(Recycler* recycler)
+        {
+            if (storage != nullptr && storage->count != 0)
             {
-                newNode->prev = last;
-                last->next = newNode;
-                last = newNode;
+                // Live iterators move on to the new storage and see only what is added after the clear
+                Storage* newStorage = Storage::New(recycler, InitialCapacity);
+                storage->ForwardTo(newStorage, ForwardKind::Cleared);
+                storage = newStorage;
             }
-
-            return newNode;
+            liveCount = 0;
         }
 
-        void Remove(MapOrSetDataNode<TData>* node)
+        // Returns the index of the new entry. If the entries have to be compacted to make room, reindex is called
+        // with each live entry and its new index before this returns.
+        template <typename FReindex>
+        uint32 Append(const TData& data, Recycler* recycler, FReindex reindex)
         {
-            // Cannot delete the node itself, nor change its next and prev pointers!
-            // Otherwise active iterators may break. Iterators depend on nodes existing
-            // until garbage collector picks them up.
-            auto next = node->next;
-            auto prev = node->prev;
+            Assert(!IsHole(data));
 
-            if (next)
+            if (storage == nullptr)
             {
-                next->prev = prev;
+                storage = Storage::New(recycler, InitialCapacity);
             }
-            else
+            else if (storage->count == storage->capacity)
             {
-                Assert(last == node);
-                last = prev;
+                Rebuild(recycler, reindex);
             }
 
-            if (prev)
+            uint32 index = storage->count;
+            storage->entries[index] = data;
+            storage->count = index + 1;
+            liveCount++;
+            return index;
+        }
+
+        void Remove(uint32 index)
+        {
+            Assert(storage != nullptr && index < storage->count && !IsHole(storage->entries[index]));
+            SetHole(storage->entries[index]);
+            liveCount--;
+        }
+
+        // Calls fn with the index and data of each live entry, in insertion order. fn must not modify the list.
+        template <typename Fn>
+        void Map(Fn fn) const
+        {
+            if (storage == nullptr)
             {
-                prev->next = next;
+                return;
             }
-            else
+
+            for (uint32 i = 0; i < storage->count; i++)
             {
-                Assert(first == node);
-                first = next;
+                if (!IsHole(storage->entries[i]))
+                {
+                    fn(i, storage->entries[i]);
+                }
             }
         }
 
@@ -194,12 +307,4 @@ namespace Js
             return Iterator(this);
         }
     };
-
-
-    template <typename TData>
-    class DelayedDeleteMapOrSetDataList : MapOrSetDataList<TData>
-    {
-        Field(SList<TData>*) deletedList;
-
-    };
 }
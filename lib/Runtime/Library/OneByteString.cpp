@@ -0,0 +1,103 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+
+namespace Js
+{
+    OneByteString::OneByteString(const char* content, charcount_t length, bool isAscii, ScriptContext* scriptContext) :
+        JavascriptString(scriptContext->GetLibrary()->GetStringTypeStatic()),
+        oneByteContent(content),
+        isAscii(isAscii)
+    {
+        this->SetLength(length);
+    }
+
+    bool OneByteString::IsAscii(_In_reads_(length) const char* content, size_t length)
+    {
+        for (size_t i = 0; i < length; i++)
+        {
+            if ((content[i] & 0x80) != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    JavascriptString* OneByteString::New(_In_reads_(length) const char* content, charcount_t length, bool isAscii, ScriptContext* scriptContext)
+    {
+        if (length == 0)
+        {
+            return scriptContext->GetLibrary()->GetEmptyString();
+        }
+
+        if (!IsValidCharCount(length))
+        {
+            JavascriptError::ThrowOutOfMemoryError(scriptContext);
+        }
+
+        Recycler* recycler = scriptContext->GetRecycler();
+        char* buffer = RecyclerNewArrayLeaf(recycler, char, length);
+        js_memcpy_s(buffer, length, content, length);
+
+        Assert(!isAscii || IsAscii(buffer, length));
+        return RecyclerNew(recycler, OneByteString, buffer, length, isAscii, scriptContext);
+    }
+
+    const char16* OneByteString::GetSz()
+    {
+        if (this->IsFinalized())
+        {
+            return this->UnsafeGetBuffer();
+        }
+
+        const charcount_t length = this->GetLength();
+        char16* target = RecyclerNewArrayLeaf(this->GetScriptContext()->GetRecycler(), char16, length + 1);
+        const unsigned char* source = reinterpret_cast<const unsigned char*>(this->oneByteContent);
+        for (charcount_t i = 0; i < length; i++)
+        {
+            target[i] = static_cast<char16>(source[i]);
+        }
+        target[length] = _u('\0');
+
+        this->SetBuffer(target);
+
+        // The wide buffer is authoritative from here on; let the one-byte copy be collected
+        this->oneByteContent = nullptr;
+
+        return target;
+    }
+
+    size_t OneByteString::GetAllocatedByteCount() const
+    {
+        if (!this->IsFinalized())
+        {
+            return this->GetLength();
+        }
+        return __super::GetAllocatedByteCount();
+    }
+
+    void OneByteString::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+        Assert(!this->IsFinalized());
+
+        // Widen straight into the destination so flattening a concat doesn't also widen this string
+        const charcount_t length = this->GetLength();
+        const unsigned char* source = reinterpret_cast<const unsigned char*>(this->oneByteContent);
+        for (charcount_t i = 0; i < length; i++)
+        {
+            buffer[i] = static_cast<char16>(source[i]);
+        }
+    }
+
+    template <> bool VarIsImpl<OneByteString>(RecyclableObject* obj)
+    {
+        return VirtualTableInfo<OneByteString>::HasVirtualTable(obj);
+    }
+}
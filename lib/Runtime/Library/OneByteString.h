@@ -0,0 +1,40 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // A string whose characters all fit in one byte (Latin-1). The content is kept at one byte per
+    // character and only widened to char16 the first time a flat buffer is requested.
+    class OneByteString sealed : public JavascriptString
+    {
+        Field(const char*) oneByteContent;      // nullptr once the string has been widened
+        Field(bool) isAscii;                    // Content is also valid UTF-8
+
+        OneByteString(const char* content, charcount_t length, bool isAscii, ScriptContext* scriptContext);
+
+    protected:
+        DEFINE_VTABLE_CTOR(OneByteString, JavascriptString);
+
+    public:
+        // Below this length the string is likely to be used as a property name, where the savings don't pay off
+        static const charcount_t MinLength = 16;
+
+        static bool IsAscii(_In_reads_(length) const char* content, size_t length);
+
+        // Copies the content; every byte is taken as the Latin-1 character of the same value
+        static JavascriptString* New(_In_reads_(length) const char* content, charcount_t length, bool isAscii, ScriptContext* scriptContext);
+
+        // Returns the one-byte content, or nullptr if the string has already been widened
+        const char* GetOneByteContent() const { return this->oneByteContent; }
+        bool IsAsciiContent() const { return this->isAscii; }
+
+        virtual const char16* GetSz() override;
+        virtual size_t GetAllocatedByteCount() const override;
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override;
+    };
+
+    template <> bool VarIsImpl<OneByteString>(RecyclableObject* obj);
+}
@@ -235,6 +235,22 @@ namespace Js
         UnifiedRegex::Program* program = UnifiedRegex::Program::New(recycler, flags);
         parser.CaptureSourceAndGroups(recycler, program, psz, csz, csz);
 
+        ThreadContext* threadContext = scriptContext->GetThreadContext();
+        UnifiedRegex::SharedRegexProgram* sharedProgram =
+            threadContext->FindSharedRegexProgram(UnifiedRegex::RegexKey(program->source, program->sourceLen, flags));
+        if (sharedProgram != nullptr)
+        {
+            // Another script context of this runtime has already compiled this regex
+            UnifiedRegex::RegexPattern* sharedPattern =
+                UnifiedRegex::RegexPattern::New(scriptContext, sharedProgram->program, isLiteralSource);
+            sharedPattern->sharedProgram = sharedProgram;
+            END_TEMP_ALLOCATOR(ctAllocator, scriptContext);
+#ifdef PROFILE_EXEC
+            scriptContext->ProfileEnd(Js::RegexCompilePhase);
+#endif
+            return sharedPattern;
+        }
+
         UnifiedRegex::RegexPattern* pattern = UnifiedRegex::RegexPattern::New(scriptContext, program, isLiteralSource);
 
 #if ENABLE_REGEX_CONFIG_OPTIONS
@@ -254,6 +270,14 @@ namespace Js
             scriptContext->GetRegexStatsDatabase()->BeginProfile();
 #endif
 
+        ArenaAllocator* sharedAllocator = program->IsShareableAcrossScriptContexts() ? threadContext->GetSharedRegexAllocator() : nullptr;
+        if (sharedAllocator != nullptr)
+        {
+            // Set before compiling so that the pattern never frees the body into the wrong allocator
+            rtAllocator = sharedAllocator;
+            pattern->sharedProgram = UnifiedRegex::SharedRegexProgram::New(recycler, program, sharedAllocator);
+        }
+
         UnifiedRegex::Compiler::Compile
             ( scriptContext
             , ctAllocator
@@ -274,6 +298,11 @@ namespace Js
             scriptContext->GetRegexStatsDatabase()->EndProfile(stats, UnifiedRegex::RegexStats::Compile);
 #endif
 
+        if (sharedAllocator != nullptr)
+        {
+            threadContext->AddSharedRegexProgram(pattern->sharedProgram);
+        }
+
         END_TEMP_ALLOCATOR(ctAllocator, scriptContext);
 #ifdef PROFILE_EXEC
         scriptContext->ProfileEnd(Js::RegexCompilePhase);
@@ -549,7 +578,10 @@ namespace Js
             {
                 if (arrayResult == 0)
                     arrayResult = CreateMatchResult(stackAllocationPointer, scriptContext, isGlobal, pattern->NumGroups(), input);
-                JavascriptString *const matchedString = SubString::New(input, lastActualMatch.offset, lastActualMatch.length);
+                // Empty and very short matches, common for global patterns such as /\w/g, come from the library's
+                // string caches rather than each allocating a substring
+                JavascriptString *const matchedString =
+                    UnsafeVarTo<JavascriptString>(GetString(scriptContext, input, nullptr, lastActualMatch));
                 if (isGlobal)
                     arrayResult->DirectSetItemAt(globalIndex, matchedString);
                 else
@@ -759,11 +791,12 @@ namespace Js
         return JavascriptBoolean::ToVar(wasFound, scriptContext);
     }
 
-    template<typename GroupFn>
+    // appendGroup(captureIndex, concatenated) appends the text of the given group if it participated in the match
+    template<typename AppendGroupFn>
     void RegexHelper::ReplaceFormatString
         ( ScriptContext* scriptContext
         , int numGroups
-        , GroupFn getGroup
+        , AppendGroupFn appendGroup
         , JavascriptString* input
         , const char16* matchedString
         , UnifiedRegex::GroupInfo match
@@ -772,7 +805,6 @@ namespace Js
         , __in_ecount(substitutions) CharCount* substitutionOffsets
         , CompoundString::Builder<64 * sizeof(void *) / sizeof(char16)>& concatenated )
     {
-        Var nonMatchValue = NonMatchValue(scriptContext, false);
         const CharCount inputLength = input->GetLength();
         const char16* replaceStr = replace->GetString();
         const CharCount replaceLength = replace->GetLength();
@@ -810,11 +842,7 @@ namespace Js
                 Assert(captureIndex < 100); // as above, value of 2-digit positive decimal number
                 if (captureIndex < numGroups && (captureIndex != 0))
                 {
-                    Var group = getGroup(captureIndex, nonMatchValue);
-                    if (VarIs<JavascriptString>(group))
-                        concatenated.Append(UnsafeVarTo<JavascriptString>(group));
-                    else if (group != nonMatchValue)
-                        concatenated.Append(replace, substitutionOffset, offset - substitutionOffset);
+                    appendGroup(captureIndex, concatenated);
                 }
                 else
                     concatenated.Append(replace, substitutionOffset, offset - substitutionOffset);
@@ -934,15 +962,20 @@ namespace Js
                 replace->GetLength(),
                 tempAlloc,
                 &substitutionOffsets);
-            auto getGroup = [&](int captureIndex, Var nonMatchValue) {
-                return captureIndex <= numberOfCaptures ? PointerValue(captures[captureIndex]) : nonMatchValue;
+            auto appendGroup = [&](int captureIndex, CompoundString::Builder<64 * sizeof(void *) / sizeof(char16)>& builder) {
+                // Captures are either strings or undefined
+                Var group = captureIndex <= numberOfCaptures ? PointerValue(captures[captureIndex]) : nullptr;
+                if (group != nullptr && VarIs<JavascriptString>(group))
+                {
+                    builder.Append(UnsafeVarTo<JavascriptString>(group));
+                }
             };
             UnifiedRegex::GroupInfo match(position, matchStr->GetLength());
             int numGroups = numberOfCaptures + 1; // Take group 0 into account.
             ReplaceFormatString(
                 scriptContext,
                 numGroups,
-                getGroup,
+                appendGroup,
                 input,
                 matchStr->GetString(),
                 match,
@@ -1182,11 +1215,17 @@ namespace Js
                 concatenated.Append(input, offset, lastActualMatch.offset - offset);
                 if (substitutionOffsets != 0)
                 {
-                    auto getGroup = [&](int captureIndex, Var nonMatchValue) {
-                        return GetGroup(scriptContext, pattern, input, nonMatchValue, captureIndex);
+                    // Groups are appended as ranges of the input, so substitutions do not allocate a string per group
+                    // per match
+                    auto appendGroup = [&](int captureIndex, CompoundString::Builder<64 * sizeof(void *) / sizeof(char16)>& builder) {
+                        UnifiedRegex::GroupInfo group = pattern->GetGroup(captureIndex);
+                        if (!group.IsUndefined())
+                        {
+                            builder.Append(input, group.offset, group.length);
+                        }
                     };
                     const char16* matchedString = inputStr + lastActualMatch.offset;
-                    ReplaceFormatString(scriptContext, pattern->NumGroups(), getGroup, input, matchedString, lastActualMatch, replace, substitutions, substitutionOffsets, concatenated);
+                    ReplaceFormatString(scriptContext, pattern->NumGroups(), appendGroup, input, matchedString, lastActualMatch, replace, substitutions, substitutionOffsets, concatenated);
                 }
                 else
                 {
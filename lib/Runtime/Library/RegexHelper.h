@@ -88,11 +88,11 @@ namespace Js
         static UnifiedRegex::GroupInfo PrimMatch(RegexMatchState& state, ScriptContext* scriptContext, UnifiedRegex::RegexPattern* pattern, CharCount inputLength, CharCount offset);
         static void PrimEndMatch(RegexMatchState& state, ScriptContext* scriptContext, UnifiedRegex::RegexPattern* pattern);
 
-        template<typename GroupFn>
+        template<typename AppendGroupFn>
         static void ReplaceFormatString
             ( ScriptContext* scriptContext
             , int numGroups
-            , GroupFn getGroup
+            , AppendGroupFn appendGroup
             , JavascriptString* input
             , const char16* matchedString
             , UnifiedRegex::GroupInfo match
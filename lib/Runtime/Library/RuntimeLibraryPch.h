@@ -27,6 +27,7 @@
 #include "Library/ProfileString.h"
 #include "Library/SingleCharString.h"
 #include "Library/SubString.h"
+#include "Library/OneByteString.h"
 #include "Library/BufferStringBuilder.h"
 
 #include "Library/BoundFunction.h"
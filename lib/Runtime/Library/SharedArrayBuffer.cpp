@@ -711,6 +711,23 @@ namespace Js
         DWORD result = WaitForSingleObject(agent.event, timeout);
         csForAccess.Enter();
         return result == WAIT_OBJECT_0;
+#elif defined(__linux__)
+        Assert(m_waiters != nullptr);
+        Assert(waiter != NULL);
+        Assert(!Contains(waiter));
+
+        // RemoveAndWakeWaiters sets and wakes the word while holding csForAccess, which this function takes back before
+        // returning, so the word stays alive for as long as the waiter list refers to it
+        volatile uint32 wakeWord = 0;
+        AgentOfBuffer agent(waiter, &wakeWord);
+        m_waiters->Add(agent);
+
+        csForAccess.Leave();
+        PlatformAgnostic::Futex::Wait(&wakeWord, 0, timeout);
+        csForAccess.Enter();
+
+        // A wake up that raced with the timeout still counts: the agent has already been removed from the list
+        return wakeWord != 0;
 #else
         // TODO for xplat
         return false;
@@ -732,8 +749,21 @@ namespace Js
         }
 
         Assert(false);
-#endif
+#elif defined(__linux__)
+        Assert(m_waiters != nullptr);
+        for (int i = m_waiters->Count() - 1; i >= 0; i--)
+        {
+            if (m_waiters->Item(i).identity == waiter)
+            {
+                m_waiters->RemoveAt(i);
+                return;
+            }
+        }
+
+        Assert(false);
+#else
         // TODO for xplat
+#endif
     }
 
     uint32 WaiterList::RemoveAndWakeWaiters(int32 count)
@@ -750,6 +780,15 @@ namespace Js
             SetEvent(agent.event);
             // This agent will be closed when their respective call to wait has returned
         }
+#elif defined(__linux__)
+        while (count > 0 && m_waiters->Count() > 0)
+        {
+            AgentOfBuffer agent = m_waiters->Item(0);
+            m_waiters->RemoveAt(0);
+            count--; removed++;
+            *agent.wakeWord = 1;
+            PlatformAgnostic::Futex::Wake(agent.wakeWord, 1);
+        }
 #endif
         return removed;
     }
@@ -169,12 +169,15 @@ namespace Js
     struct AgentOfBuffer
     {
     public:
-        AgentOfBuffer() :identity(NULL), event(NULL) {}
-        AgentOfBuffer(DWORD_PTR agent, HANDLE e) :identity(agent), event(e) {}
+        AgentOfBuffer() :identity(NULL), event(NULL), wakeWord(nullptr) {}
+        AgentOfBuffer(DWORD_PTR agent, HANDLE e) :identity(agent), event(e), wakeWord(nullptr) {}
+        AgentOfBuffer(DWORD_PTR agent, volatile uint32 *w) :identity(agent), event(NULL), wakeWord(w) {}
         static bool AgentCanSuspend(ScriptContext *scriptContext);
 
         DWORD_PTR identity;
         HANDLE event;
+        // Futex word on the waiting agent's stack, set to 1 when the agent is woken (Linux)
+        volatile uint32 *wakeWord;
     };
 
     typedef JsUtil::List<AgentOfBuffer, HeapAllocator> Waiters;
@@ -28,6 +28,7 @@ namespace Js
         body->SetOriginalEntryPoint(AsmJsDefaultEntryThunk);
         // Reset jit status for this function
         body->SetIsAsmJsFullJitScheduled(false);
+        body->SetIsWasmBaselineJitScheduled(false);
         Assert(body->HasValidEntryPoint());
     }
 }
@@ -73,7 +74,7 @@ Js::JavascriptMethod Js::WasmLibrary::EnsureWasmEntrypoint(Js::ScriptFunction* f
             }
         }
         // The function has already been parsed, just fix up the entry point
-        else if (body->GetIsAsmJsFullJitScheduled())
+        else if (body->GetIsAsmJsFullJitScheduled() || body->GetIsWasmBaselineJitScheduled())
         {
             Js::FunctionEntryPointInfo* defaultEntryPoint = (Js::FunctionEntryPointInfo*)body->GetDefaultEntryPointInfo();
             func->ChangeEntryPoint(defaultEntryPoint, defaultEntryPoint->jsMethod);
@@ -219,6 +219,47 @@ WebAssemblyMemory::GrowHelper(WebAssemblyMemory * mem, uint32 deltaPages)
     JIT_HELPER_END(Op_GrowWasmMemory);
 }
 
+void
+WebAssemblyMemory::CopyInternal(uint32 destination, uint32 source, uint32 length)
+{
+    // Check the whole range once up front, nothing is written if either end is out of bounds
+    const uint32 byteLength = m_buffer->GetByteLength();
+    if ((uint64)destination + length > byteLength || (uint64)source + length > byteLength)
+    {
+        JavascriptError::ThrowWebAssemblyRuntimeError(GetScriptContext(), WASMERR_ArrayIndexOutOfRange);
+    }
+    BYTE* buffer = m_buffer->GetBuffer();
+    // The ranges may overlap
+    memmove(buffer + destination, buffer + source, length);
+}
+
+void
+WebAssemblyMemory::FillInternal(uint32 destination, uint32 value, uint32 length)
+{
+    const uint32 byteLength = m_buffer->GetByteLength();
+    if ((uint64)destination + length > byteLength)
+    {
+        JavascriptError::ThrowWebAssemblyRuntimeError(GetScriptContext(), WASMERR_ArrayIndexOutOfRange);
+    }
+    memset(m_buffer->GetBuffer() + destination, (uint8)value, length);
+}
+
+void
+WebAssemblyMemory::CopyHelper(WebAssemblyMemory * mem, uint32 destination, uint32 source, uint32 length)
+{
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Op_WasmMemoryCopy);
+    mem->CopyInternal(destination, source, length);
+    JIT_HELPER_END(Op_WasmMemoryCopy);
+}
+
+void
+WebAssemblyMemory::FillHelper(WebAssemblyMemory * mem, uint32 destination, uint32 value, uint32 length)
+{
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Op_WasmMemoryFill);
+    mem->FillInternal(destination, value, length);
+    JIT_HELPER_END(Op_WasmMemoryFill);
+}
+
 #if DBG
 void WebAssemblyMemory::TraceMemWrite(WebAssemblyMemory* mem, uint32 index, uint32 offset, Js::ArrayBufferView::ViewType viewType, uint32 bytecodeOffset, ScriptContext* context)
 {
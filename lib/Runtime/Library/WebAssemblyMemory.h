@@ -44,6 +44,11 @@ namespace Js
         int32 GrowInternal(uint32 deltaPages);
         static int32 GrowHelper(Js::WebAssemblyMemory * memory, uint32 deltaPages);
 
+        void CopyInternal(uint32 destination, uint32 source, uint32 length);
+        void FillInternal(uint32 destination, uint32 value, uint32 length);
+        static void CopyHelper(Js::WebAssemblyMemory * memory, uint32 destination, uint32 source, uint32 length);
+        static void FillHelper(Js::WebAssemblyMemory * memory, uint32 destination, uint32 value, uint32 length);
+
         static int GetOffsetOfArrayBuffer() { return offsetof(WebAssemblyMemory, m_buffer); }
 #if DBG
         static void TraceMemWrite(WebAssemblyMemory* mem, uint32 index, uint32 offset, Js::ArrayBufferView::ViewType viewType, uint32 bytecodeOffset, ScriptContext* context);
@@ -0,0 +1,52 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "Common.h"
+#include "ChakraPlatform.h"
+#include <errno.h>
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace PlatformAgnostic
+{
+    bool Futex::Wait(volatile uint32 *address, uint32 expected, uint32 timeout)
+    {
+        // FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC deadline, so spurious wake ups and signals do not
+        // restart the timeout
+        struct timespec deadline;
+        if (timeout != INFINITE)
+        {
+            clock_gettime(CLOCK_MONOTONIC, &deadline);
+            deadline.tv_sec += timeout / 1000;
+            deadline.tv_nsec += (long)(timeout % 1000) * 1000000;
+            if (deadline.tv_nsec >= 1000000000)
+            {
+                deadline.tv_sec++;
+                deadline.tv_nsec -= 1000000000;
+            }
+        }
+
+        while (*address == expected)
+        {
+            long result = syscall(SYS_futex, (uint32 *)address, FUTEX_WAIT_BITSET_PRIVATE, expected,
+                timeout != INFINITE ? &deadline : nullptr, nullptr, FUTEX_BITSET_MATCH_ANY);
+            if (result != 0 && errno == ETIMEDOUT)
+            {
+                return *address != expected;
+            }
+            // Otherwise woken, interrupted, or the word had already changed (EAGAIN); check the word again
+        }
+
+        return true;
+    }
+
+    void Futex::Wake(volatile uint32 *address, uint32 count)
+    {
+        syscall(SYS_futex, (uint32 *)address, FUTEX_WAKE_PRIVATE, count > INT_MAX ? INT_MAX : (int)count, nullptr, nullptr, 0);
+    }
+} // namespace PlatformAgnostic
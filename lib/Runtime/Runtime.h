@@ -27,6 +27,8 @@ enum SymbolType : byte;
 namespace UnifiedRegex
 {
     struct RegexPattern;
+    struct Program;                                 // Used by ThreadContext.h
+    struct SharedRegexProgram;                      // Used by ThreadContext.h
     template <typename T> class StandardChars;      // Used by ThreadContext.h
     struct TrigramAlphabet;
     struct RegexStacks;
@@ -451,6 +451,23 @@ WasmOp WasmBinaryReader::ReadExpr()
         }
         break;
     }
+    case wbMemoryCopy:
+    case wbMemoryFill:
+    {
+        // Reserved memory indices, memory.copy has one for each of its destination and source
+        const uint32 reservedCount = op == wbMemoryCopy ? 2 : 1;
+        for (uint32 i = 0; i < reservedCount; ++i)
+        {
+            if (ReadConst<uint8>() != 0)
+            {
+                ThrowDecodingError(op == wbMemoryCopy
+                    ? _u("memory.copy reserved value must be 0")
+                    : _u("memory.fill reserved value must be 0")
+                );
+            }
+        }
+        break;
+    }
 #ifdef ENABLE_WASM_SIMD
     case wbV8X16Shuffle:
         ShuffleNode();
@@ -829,8 +846,9 @@ void WasmBinaryReader::ReadExportSection()
     m_module->AllocateFunctionExports(numExports);
 
     ArenaAllocator tmpAlloc(_u("ExportDupCheck"), m_module->GetScriptContext()->GetThreadContext()->GetPageAllocator(), Js::Throw::OutOfMemory);
-    typedef SList<const char16*> NameList;
-    JsUtil::BaseDictionary<uint32, NameList*, ArenaAllocator> exportsNameDict(&tmpAlloc);
+    // Hashed on the whole name, so that modules with many exports named alike (e.g. all of the same length) are
+    // still checked in linear time
+    JsUtil::BaseHashSet<JsUtil::CharacterBuffer<char16>, ArenaAllocator> exportNames(&tmpAlloc);
 
     for (uint32 iExport = 0; iExport < numExports; iExport++)
     {
@@ -838,23 +856,12 @@ void WasmBinaryReader::ReadExportSection()
         const char16* exportName = ReadInlineName(length, nameLength);
 
         // Check if the name is already used
-        NameList* list = nullptr;
-        if (exportsNameDict.TryGetValue(nameLength, &list))
-        {
-            const char16** found = list->Find([exportName, nameLength](const char16* existing) { 
-                return wcsncmp(exportName, existing, nameLength) == 0;
-            });
-            if (found)
-            {
-                ThrowDecodingError(_u("Duplicate export name: %s"), exportName);
-            }
-        }
-        else
+        JsUtil::CharacterBuffer<char16> exportNameBuffer(exportName, nameLength);
+        if (exportNames.Contains(exportNameBuffer))
         {
-            list = Anew(&tmpAlloc, NameList, &tmpAlloc);
-            exportsNameDict.Add(nameLength, list);
+            ThrowDecodingError(_u("Duplicate export name: %s"), exportName);
         }
-        list->Push(exportName);
+        exportNames.Add(exportNameBuffer);
 
         ExternalKinds kind = ReadExternalKind();
         uint32 index = LEB128(length);
@@ -241,7 +241,9 @@ typedef void(*AfterSectionCallback)(WasmModuleGenerator*);
 WasmModuleGenerator::WasmModuleGenerator(Js::ScriptContext* scriptContext, Js::WebAssemblySource* src) :
     m_sourceInfo(src->GetSourceInfo()),
     m_scriptContext(scriptContext),
-    m_recycler(scriptContext->GetRecycler())
+    m_recycler(scriptContext->GetRecycler()),
+    m_functionExports(nullptr),
+    m_functionExportsCount(0)
 {
     m_module = RecyclerNewFinalized(m_recycler, Js::WebAssemblyModule, scriptContext, src->GetBuffer(), src->GetBufferLength(), scriptContext->GetLibrary()->GetWebAssemblyModuleType());
 
@@ -301,6 +303,9 @@ Js::WebAssemblyModule* WasmModuleGenerator::GenerateModule()
     sourceContextInfo->nextLocalFunctionId += funcCount;
     sourceContextInfo->EnsureInitialized();
 
+    ArenaAllocator tmpAlloc(_u("WasmFunctionExports"), m_scriptContext->GetThreadContext()->GetPageAllocator(), Js::Throw::OutOfMemory);
+    MapFunctionExports(&tmpAlloc);
+
     for (uint32 i = 0; i < funcCount; ++i)
     {
         GenerateFunctionHeader(i);
@@ -352,6 +357,8 @@ Js::WebAssemblyModule* WasmModuleGenerator::GenerateModule()
         throw WasmCompilationException(_u("Missing required section: %s"), SectionInfo::All[bSectFunctionBodies].name);
     }
 
+    m_functionExports = nullptr;
+    m_functionExportsCount = 0;
     return m_module;
 }
 
@@ -360,6 +367,32 @@ WasmBinaryReader* WasmModuleGenerator::GetReader() const
     return m_module->GetReader();
 }
 
+void WasmModuleGenerator::MapFunctionExports(ArenaAllocator* alloc)
+{
+    // Looking up each function's export by scanning all exports would be quadratic in the size of modules that
+    // export most of their functions
+    m_functionExportsCount = m_module->GetWasmFunctionCount();
+    m_functionExports = AnewArrayZ(alloc, WasmExport*, m_functionExportsCount);
+    for (uint32 iExport = 0; iExport < m_module->GetExportCount(); ++iExport)
+    {
+        Wasm::WasmExport* wasmExport = m_module->GetExport(iExport);
+        if (wasmExport &&
+            wasmExport->kind == ExternalKinds::Function &&
+            wasmExport->nameLength > 0 &&
+            wasmExport->index < m_functionExportsCount &&
+            m_module->GetFunctionIndexType(wasmExport->index) == FunctionIndexTypes::Function &&
+            !m_functionExports[wasmExport->index])
+        {
+            m_functionExports[wasmExport->index] = wasmExport;
+        }
+    }
+}
+
+WasmExport* WasmModuleGenerator::GetFunctionExport(uint32 funcIndex) const
+{
+    return funcIndex < m_functionExportsCount ? m_functionExports[funcIndex] : nullptr;
+}
+
 void WasmModuleGenerator::GenerateFunctionHeader(uint32 index)
 {
     WasmFunctionInfo* wasmInfo = m_module->GetWasmFunctionInfo(index);
@@ -378,21 +411,13 @@ void WasmModuleGenerator::GenerateFunctionHeader(uint32 index)
     }
     else
     {
-        for (uint32 iExport = 0; iExport < m_module->GetExportCount(); ++iExport)
+        Wasm::WasmExport* wasmExport = GetFunctionExport(wasmInfo->GetNumber());
+        if (wasmExport)
         {
-            Wasm::WasmExport* wasmExport = m_module->GetExport(iExport);
-            if (wasmExport  &&
-                wasmExport->kind == ExternalKinds::Function &&
-                wasmExport->nameLength > 0 &&
-                m_module->GetFunctionIndexType(wasmExport->index) == FunctionIndexTypes::Function &&
-                wasmExport->index == wasmInfo->GetNumber())
-            {
-                nameLength = wasmExport->nameLength + 16;
-                char16 * autoName = RecyclerNewArrayLeafZ(m_recycler, char16, nameLength);
-                nameLength = swprintf_s(autoName, nameLength, _u("%s[%u]"), wasmExport->name, wasmInfo->GetNumber());
-                functionName = autoName;
-                break;
-            }
+            nameLength = wasmExport->nameLength + 16;
+            char16 * autoName = RecyclerNewArrayLeafZ(m_recycler, char16, nameLength);
+            nameLength = swprintf_s(autoName, nameLength, _u("%s[%u]"), wasmExport->name, wasmInfo->GetNumber());
+            functionName = autoName;
         }
     }
 
@@ -754,6 +779,12 @@ void WasmBytecodeGenerator::EmitExpr(WasmOp op)
         info = EmitGrowMemory();
         break;
     }
+    case wbMemoryCopy:
+        info = EmitBulkMemory(Js::OpCodeAsmJs::MemoryCopy);
+        break;
+    case wbMemoryFill:
+        info = EmitBulkMemory(Js::OpCodeAsmJs::MemoryFill);
+        break;
     case wbUnreachable:
         m_writer->EmptyAsm(Js::OpCodeAsmJs::Unreachable_Void);
         SetUnreachableState(true);
@@ -1423,6 +1454,23 @@ EmitInfo WasmBytecodeGenerator::EmitGrowMemory()
     return info;
 }
 
+EmitInfo WasmBytecodeGenerator::EmitBulkMemory(Js::OpCodeAsmJs op)
+{
+    SetUsesMemory(0);
+
+    // memory.copy takes (destination, source, length) and memory.fill takes (destination, value, length)
+    EmitInfo lengthInfo = PopEvalStack(WasmTypes::I32, _u("Invalid type for bulk memory length"));
+    EmitInfo srcInfo = PopEvalStack(WasmTypes::I32, op == Js::OpCodeAsmJs::MemoryCopy ? _u("Invalid type for memory.copy source") : _u("Invalid type for memory.fill value"));
+    EmitInfo dstInfo = PopEvalStack(WasmTypes::I32, _u("Invalid type for bulk memory destination"));
+
+    m_writer->AsmReg3(op, dstInfo.location, srcInfo.location, lengthInfo.location);
+
+    ReleaseLocation(&lengthInfo);
+    ReleaseLocation(&srcInfo);
+    ReleaseLocation(&dstInfo);
+    return EmitInfo();
+}
+
 EmitInfo WasmBytecodeGenerator::EmitDrop()
 {
     EmitInfo info = PopValuePolymorphic();
@@ -179,11 +179,16 @@ namespace Wasm
         void GenerateFunctionHeader(uint32 index);
     private:
         WasmBinaryReader* GetReader() const;
+        void MapFunctionExports(ArenaAllocator* alloc);
+        WasmExport* GetFunctionExport(uint32 funcIndex) const;
 
         Memory::Recycler* m_recycler;
         Js::Utf8SourceInfo* m_sourceInfo;
         Js::ScriptContext* m_scriptContext;
         Js::WebAssemblyModule* m_module;
+        // First named export of each function, used to name the function bodies. Only valid during GenerateModule.
+        WasmExport** m_functionExports;
+        uint32 m_functionExportsCount;
     };
 
     class WasmBytecodeGenerator
@@ -216,6 +221,7 @@ namespace Wasm
         void EmitBrTable();
         EmitInfo EmitDrop();
         EmitInfo EmitGrowMemory();
+        EmitInfo EmitBulkMemory(Js::OpCodeAsmJs op);
         EmitInfo EmitGetLocal();
         EmitInfo EmitGetGlobal();
         EmitInfo EmitSetGlobal();
@@ -56,6 +56,18 @@ bool IsEnabled()
 }
 }
 
+namespace BulkMemory
+{
+bool IsEnabled()
+{
+#ifdef ENABLE_WASM
+    return CONFIG_FLAG(WasmBulkMemory);
+#else
+    return false;
+#endif
+}
+}
+
 }
 
 
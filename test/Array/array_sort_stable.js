@@ -0,0 +1,105 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+function assert(condition, message)
+{
+    if (!condition)
+    {
+        throw new Error(message);
+    }
+}
+
+function stringOrder(a, b)
+{
+    a = String(a);
+    b = String(b);
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
+function checkSameOrder(actual, expected, message)
+{
+    assert(actual.length === expected.length, message + ": length " + actual.length);
+    for (let i = 0; i < expected.length; ++i)
+    {
+        assert(actual[i] === expected[i], message + ": mismatch at index " + i);
+    }
+}
+
+// Comparer sort of more than 512 elements keeps equal keys in input order, for sorted, reversed and shuffled keys
+for (const size of [513, 1000, 4099])
+{
+    const inputs = {
+        ascending: i => i >> 2,
+        descending: i => (size - i) >> 2,
+        sawtooth: i => i % 37,
+        shuffled: i => (i * 7919) % 101
+    };
+    for (const name in inputs)
+    {
+        const arr = [];
+        for (let i = 0; i < size; ++i)
+        {
+            arr.push({ key: inputs[name](i), index: i });
+        }
+        arr.sort((a, b) => a.key - b.key);
+        for (let i = 1; i < size; ++i)
+        {
+            assert(arr[i - 1].key < arr[i].key || (arr[i - 1].key === arr[i].key && arr[i - 1].index < arr[i].index),
+                name + " " + size + ": not stable at index " + i);
+        }
+    }
+}
+
+// Default sort keeps values with equal strings in input order
+{
+    const arr = [];
+    for (let i = 0; i < 1500; ++i)
+    {
+        arr.push(i % 3 === 0 ? String(i % 50) : (i % 3 === 1 ? i % 50 : new Number(i % 50)));
+    }
+    const expected = arr.slice().sort(stringOrder);
+    checkSameOrder(arr.slice().sort(), expected, "default sort of mixed values");
+}
+
+// Default sort of int arrays orders by decimal strings, including negative values and int32 extremes
+{
+    const arr = [10, 9, 1, -1, -10, -9, 0, 100, 2147483647, -2147483648, 21474836, -214748364, 5, 50, 500, -5, -50];
+    for (let i = 0; i < 1200; ++i)
+    {
+        arr.push(((i * 2654435761) | 0) % (i % 2 ? 1000 : 100000000));
+    }
+    const expected = arr.slice().sort(stringOrder);
+    const sorted = arr.slice();
+    assert(sorted.sort() === sorted, "sort returns the array");
+    checkSameOrder(sorted, expected, "default sort of ints");
+}
+
+// A throwing comparer leaves the array a permutation of its input
+{
+    const arr = [];
+    for (let i = 0; i < 2000; ++i)
+    {
+        arr.push((i * 7919) % 2000);
+    }
+    let calls = 0;
+    try
+    {
+        arr.sort((a, b) => { if (++calls === 5000) { throw new Error("stop"); } return a - b; });
+        assert(false, "comparer did not throw");
+    }
+    catch (e)
+    {
+        assert(e.message === "stop", "unexpected exception " + e.message);
+    }
+    const seen = new Array(2000).fill(false);
+    for (const v of arr)
+    {
+        assert(!seen[v], "duplicate value " + v);
+        seen[v] = true;
+    }
+    assert(arr.length === 2000, "length changed");
+}
+
+WScript.Echo("pass");
@@ -71,6 +71,28 @@ var tests = [
             assert.isTrue(y == 24n);
         }
     },
+    {
+        name: "Operands above the Karatsuba threshold",
+        body: function () {
+            // (10^a - 1) * (10^b - 1) for balanced and unbalanced operand lengths
+            function nines(count) {
+                return eval('9'.repeat(count) + 'n');
+            }
+            function expected(a, b) {
+                return eval('9'.repeat(b - 1) + '8' + '9'.repeat(a - b) + '0'.repeat(b - 1) + '1n');
+            }
+            assert.isTrue(nines(1200) * nines(1200) == expected(1200, 1200));
+            assert.isTrue(nines(5000) * nines(1200) == expected(5000, 1200));
+            assert.isTrue(nines(1200) * nines(5000) == expected(5000, 1200));
+            assert.isTrue(nines(6000) * nines(5999) == expected(6000, 5999));
+
+            var x = eval('31415926535897932384626433832795028841971'.repeat(60) + 'n');
+            var y = eval('27182818284590452353602874713527'.repeat(45) + 'n');
+            assert.isTrue((x + y) * (x - y) == x * x - y * y);
+            assert.isTrue(x * (y + 1n) == x * y + x);
+            assert.isTrue(-x * y == -(x * y));
+        }
+    },
 ];
 
 testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,60 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// JSON.parse skips plain runs of string characters in blocks. Place escapes, quotes and control
+// characters at every offset around the block boundaries to make sure none of them are missed.
+
+var TEST = function(a, b, message) {
+  if (a !== b) {
+    throw new Error(message + ": " + JSON.stringify(a) + " !== " + JSON.stringify(b));
+  }
+}
+
+var escapes = [
+  ['\\"', '"'],
+  ['\\\\', '\\'],
+  ['\\/', '/'],
+  ['\\n', '\n'],
+  ['\\t', '\t'],
+  ['\\u0041', 'A'],
+  ['\\u2028', '\u2028'],
+  ['\u00e9', '\u00e9'],
+  ['\uffff', '\uffff']
+];
+
+for (var length = 0; length < 40; length++) {
+  var plain = 'x'.repeat(length);
+  TEST(JSON.parse('"' + plain + '"'), plain, "plain string of length " + length);
+
+  for (var offset = 0; offset <= length; offset++) {
+    for (var i = 0; i < escapes.length; i++) {
+      var source = '"' + plain.substring(0, offset) + escapes[i][0] + plain.substring(offset) + '"';
+      var expected = plain.substring(0, offset) + escapes[i][1] + plain.substring(offset);
+      TEST(JSON.parse(source), expected, "escape " + i + " at " + offset + " in length " + length);
+    }
+
+    var threw = false;
+    try {
+      JSON.parse('"' + plain.substring(0, offset) + '\u0001' + plain.substring(offset) + '"');
+    } catch (e) {
+      threw = e instanceof SyntaxError;
+    }
+    TEST(threw, true, "control character at " + offset + " in length " + length);
+  }
+
+  var unterminated = false;
+  try {
+    JSON.parse('"' + plain);
+  } catch (e) {
+    unterminated = e instanceof SyntaxError;
+  }
+  TEST(unterminated, true, "unterminated string of length " + length);
+}
+
+var obj = JSON.parse('{"' + 'k'.repeat(17) + '":["' + 'v'.repeat(23) + '","a\\"b"]}');
+TEST(obj['k'.repeat(17)][0], 'v'.repeat(23), "long key and value");
+TEST(obj['k'.repeat(17)][1], 'a"b', "escaped value after long value");
+
+print("pass");
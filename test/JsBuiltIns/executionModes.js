@@ -0,0 +1,15 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Drives Math.max, a self-hosted built-in, through all of its execution modes. The calls are made through recursion rather
+// than a loop so that the full JIT threshold is not cut short by the called-from-loop heuristic.
+function callMax(n) {
+    if (n === 0) {
+        return 0;
+    }
+    return Math.max(n, 1) + callMax(n - 1);
+}
+
+WScript.Echo(callMax(100));
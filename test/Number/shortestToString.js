@@ -0,0 +1,113 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Number to string conversion must produce the shortest digits that read back
+// as the same value, whether it takes the short decimal path or the precise one.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var seed = 12345;
+function random() {
+    seed = (seed * 1103515245 + 12345) % 2147483648;
+    return seed;
+}
+
+// i / 10^k for i not ending in 0 has exactly the digits of i.
+function decimal(i, k) {
+    var s = String(i);
+    while (s.length <= k) {
+        s = "0" + s;
+    }
+    return s.slice(0, s.length - k) + "." + s.slice(s.length - k);
+}
+
+var tests = [
+    {
+        name: "Shortest digits of selected values",
+        body: function () {
+            var cases = [
+                ["0.1", "0.1"],
+                ["0.2", "0.2"],
+                ["0.3", "0.3"],
+                ["1.5", "1.5"],
+                ["12.75", "12.75"],
+                ["3.5e-7", "3.5e-7"],
+                ["1e-7", "1e-7"],
+                ["123.456", "123.456"],
+                ["0.000001", "0.000001"],
+                ["1.7976931348623157e308", "1.7976931348623157e+308"],
+                ["5e-324", "5e-324"],
+                ["0.1+0.2", "0.30000000000000004"],
+                ["2/3", "0.6666666666666666"],
+                ["1/3", "0.3333333333333333"],
+                ["9007199254740.993", "9007199254740.992"],
+                ["1e21", "1e+21"],
+                ["123456789012.34567", "123456789012.34567"],
+                ["-0.07", "-0.07"],
+                ["4.35", "4.35"],
+                ["2.675", "2.675"],
+                ["1.005", "1.005"],
+                ["3e-22", "3e-22"],
+                ["100.01", "100.01"],
+                ["-1234.5678", "-1234.5678"],
+                ["0.1*3", "0.30000000000000004"],
+                ["1e-6", "0.000001"],
+                ["123e-20", "1.23e-18"],
+                ["4503599627370495.5", "4503599627370495.5"],
+                ["450359962737049.55", "450359962737049.56"],
+                ["2**52+0.5", "4503599627370496"],
+                ["Math.PI", "3.141592653589793"],
+                ["Math.E", "2.718281828459045"],
+                ["-Math.SQRT2", "-1.4142135623730951"],
+                ["1/1024", "0.0009765625"],
+                ["0.0009765625", "0.0009765625"],
+                ["2.5e-8", "2.5e-8"],
+                ["7.0000000000000001", "7"],
+                ["99.99999999999999", "99.99999999999999"],
+                ["1e23", "1e+23"],
+                ["8.41e21", "8.41e+21"],
+                ["5e-7", "5e-7"],
+                ["0.000123", "0.000123"],
+            ];
+
+            for (var i = 0; i < cases.length; i++) {
+                var value = eval(cases[i][0]);
+                assert.areEqual(cases[i][1], String(value), cases[i][0]);
+                assert.areEqual(value, Number(String(value)), "Round trip of " + cases[i][0]);
+            }
+        }
+    },
+    {
+        name: "Short decimals print exactly their digits",
+        body: function () {
+            var powers = [10, 100, 1000, 10000, 100000, 1000000];
+            for (var n = 0; n < 5000; n++) {
+                var k = n % powers.length + 1;
+                var i = random() * (n % 7 + 1) + 1;
+                if (i % 10 === 0) {
+                    i++;
+                }
+                assert.areEqual(decimal(i, k), String(i / powers[k - 1]), i + "/10^" + k);
+            }
+        }
+    },
+    {
+        name: "Mantissas of 16 to 19 digits read back exactly",
+        body: function () {
+            var values = [0.1 + 0.2, 2 / 3, Math.PI, 1 / 3 * 1e10, 123456.78901234567, 9007199254740.993, 4.9406564584124654e-300];
+            for (var n = 0; n < 2000; n++) {
+                values.push(random() / 3 * Math.pow(10, n % 30 - 15));
+            }
+            for (var n = 0; n < values.length; n++) {
+                var s = String(values[n]);
+                assert.areEqual(values[n], Number(s), "Round trip of " + s);
+                assert.areEqual(-values[n], Number("-" + s), "Round trip of -" + s);
+                assert.areEqual(values[n], parseFloat(s), "parseFloat of " + s);
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
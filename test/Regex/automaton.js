@@ -0,0 +1,89 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Patterns prone to catastrophic backtracking are matched by a linear-time automaton. Without it, each of the
+// failing matches below would take exponential time.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function describe(result) {
+    if (result === null) {
+        return "null";
+    }
+    var groups = [];
+    for (var i = 0; i < result.length; i++) {
+        groups.push(result[i] === undefined ? "undefined" : JSON.stringify(result[i]));
+    }
+    return groups.join(",") + "@" + result.index;
+}
+
+function repeat(s, n) {
+    var result = "";
+    for (var i = 0; i < n; i++) {
+        result += s;
+    }
+    return result;
+}
+
+var as = repeat("a", 40);
+
+var cases = [
+    // Catastrophic failures
+    [/(a+)+b/, as + "c", "null"],
+    [/(a|aa)+$/, as + "!", "null"],
+    [/(a|a)*b/, as, "null"],
+    [/^(\w+\s?)+$/, repeat("word ", 10) + "!", "null"],
+    [/(x+x+)+y/, repeat("x", 40), "null"],
+    [/^(([a-z])+.)+[A-Z]([a-z])+$/, repeat("a", 40) + "!", "null"],
+    [/(?:a+)+?b/i, as + "c", "null"],
+
+    // The same patterns when they do match
+    [/(a+)+b/, "xaaab", "\"aaab\",\"aaa\"@1"],
+    [/(a|aa)+$/, "baaa", "\"aaa\",\"a\"@1"],
+    [/(a|a)*b/, "aab", "\"aab\",\"a\"@0"],
+    [/^(\w+\s?)+$/, "two words", "\"two words\",\"words\"@0"],
+    [/(x+x+)+y/, "xxxy", "\"xxxy\",\"xxx\"@0"],
+    [/(?:a+)+?b/i, "AaB", "\"AaB\"@0"],
+
+    // Captures follow the backtracking semantics
+    [/(?:(a)|b)+/, "ab", "\"ab\",undefined@0"],
+    [/(?:(a)|(b))+/, "ba", "\"ba\",\"a\",undefined@0"],
+    [/((a)|b)+/, "aab", "\"aab\",\"b\",undefined@0"],
+    [/(a+|b+)*c/, "aabbc", "\"aabbc\",\"bb\"@0"],
+    [/(a+?)+?b/, "aab", "\"aab\",\"a\"@0"],
+    [/(a|ab)(c|bcd)+(d*)/, "abcd", "\"abcd\",\"a\",\"bcd\",\"\"@0"],
+    [/((a)|(ab))+c/, "abac", "\"abac\",\"a\",\"a\",undefined@0"],
+    [/(?:(a+)|(b))+$/m, "ab\naab", "\"ab\",undefined,\"b\"@0"],
+    [/\b(\w+\s*)+\./, "a b c.", "\"a b c.\",\"c\"@0"],
+    [/(a{1,2}){2,3}?x/, "aaaaax", "\"aaaaax\",\"a\"@0"],
+];
+
+var tests = [
+    {
+        name: "Patterns prone to catastrophic backtracking",
+        body: function () {
+            for (var i = 0; i < cases.length; i++) {
+                var re = cases[i][0];
+                var input = cases[i][1];
+                assert.areEqual(cases[i][2], describe(re.exec(input)), re + " on " + JSON.stringify(input));
+            }
+        }
+    },
+    {
+        name: "Global and sticky matching resume from lastIndex",
+        body: function () {
+            assert.areEqual("aab,ab", "aab ab b".match(/(a|aa)+b/g).join(), "match");
+            assert.areEqual("<a>-" + as, (as + "b-" + as).replace(/(a|a)+b/g, "<$1>"), "replace");
+            assert.areEqual("ab|a|b||||b", "ab;aab;;b".split(/;(a|a)*/).join("|"), "split");
+
+            var sticky = /(a+)+b/y;
+            assert.areEqual("null", describe(sticky.exec("caab")), "sticky");
+            sticky.lastIndex = 1;
+            assert.areEqual("\"aab\",\"aa\"@1,4", describe(sticky.exec("aaab")) + "," + sticky.lastIndex, "sticky lastIndex");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,92 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Regexes that cannot backtrack move to the linear tier after a number of matches. Results must not change once
+// that happens, so run each case often enough to tier up and compare against the first (interpreted) result.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var cases = [
+    [/(\d+)-(\d+)x/, "12-34 56-78x"],
+    [/(\d+)-(\d+)x/, "12-34 56-78"],
+    [/\d{2,4}/, "a1b123456c"],
+    [/a[bc]+d?/, "xxabcbcbe"],
+    [/^GET (\/\w*)/, "GET /index HTTP/1.1"],
+    [/^GET (\/\w*)/, " GET /index"],
+    [/\/api\/v(\d)\/(\w+)$/, "GET /api/v2/users"],
+    [/\/api\/v(\d)\/(\w+)$/, "GET /api/v2/users?id=1"],
+    [/\bcat\b/, "concatenate cat"],
+    [/\Bcat/, "cat concat"],
+    [/error: (\w+)/i, "INFO ok\nERROR: Disk full"],
+    [/^warn/m, "info\nwarn: low\n"],
+    [/low$/m, "warn: low\ninfo"],
+    [/q(u)?x/, "qx qux"],
+    [/(a)|b/, "b"],
+    [/[^,]+,[^,]+/, "one,two,three"],
+    [/x*/, "abc"],
+    [/$/, "abc"],
+    [/\s\S\s/, "ab c d"],
+    [/[0-9a-f]{8}/, "id=0123abcd9 ff"],
+    [/\u00e9t\u00e9/, "l'\u00e9t\u00e9"],
+];
+
+function describe(result) {
+    return result === null ? "null" : JSON.stringify(result) + "@" + result.index;
+}
+
+var tests = [
+    {
+        name: "Results do not change once a regex tiers up",
+        body: function () {
+            for (var i = 0; i < cases.length; i++) {
+                var re = cases[i][0];
+                var input = cases[i][1];
+                var expected = describe(re.exec(input));
+                for (var n = 0; n < 50; n++) {
+                    assert.areEqual(expected, describe(re.exec(input)), re + " on " + JSON.stringify(input) + " #" + n);
+                }
+            }
+        }
+    },
+    {
+        name: "Global and sticky matching resume from lastIndex",
+        body: function () {
+            var words = /\w+/g;
+            for (var n = 0; n < 50; n++) {
+                assert.areEqual("log,line,42,ok", "log line 42 ok".match(words).join(), "Global match #" + n);
+            }
+
+            var sticky = /\d+/y;
+            for (var n = 0; n < 50; n++) {
+                sticky.lastIndex = 0;
+                var first = sticky.exec("123abc");
+                var second = sticky.exec("123abc");
+                assert.areEqual("[\"123\"]@0 null 0", describe(first) + " " + describe(second) + " " + sticky.lastIndex, "Sticky #" + n);
+            }
+
+            var fields = /(\w+)=(\d+)/g;
+            for (var n = 0; n < 50; n++) {
+                assert.areEqual("1:a, 22:b; c=x", "a=1, b=22; c=x".replace(fields, "$2:$1"), "Replace #" + n);
+            }
+
+            var separator = /\s*;\s*/;
+            for (var n = 0; n < 50; n++) {
+                assert.areEqual("a|b|c|d", "a ; b;c  ;  d".split(separator).join("|"), "Split #" + n);
+            }
+        }
+    },
+    {
+        name: "A failed attempt that defined a group does not leave it set for a later match",
+        body: function () {
+            var optional = /(\d)?:(x)/;
+            for (var n = 0; n < 50; n++) {
+                var m = optional.exec("1:y :x");
+                assert.areEqual(":x,undefined,x", m[0] + "," + m[1] + "," + m[2], "Group reset #" + n);
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
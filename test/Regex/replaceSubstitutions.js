@@ -0,0 +1,87 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Global replace with a replacement string appends groups straight from the input, and global match takes short
+// matches from the string caches. Check both against the results of the generic RegExp.prototype[Symbol.replace]
+// path, which is taken for RegExp subclasses and builds a match result for each match.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+class SubRegExp extends RegExp {
+}
+
+var replaceCases = [
+    [/(\d+)-(\d+)/g, "12-34 5-6 x-y 789-0", "$2-$1"],
+    [/(\d+)-(\d+)/g, "12-34 5-6", "[$&] [$`] [$'] $$ $3 $0 $"],
+    [/(a)|(b)/g, "abcab", "<$1|$2>"],
+    [/(a)(b)?/g, "a ab a", "$2$1$2"],
+    [/(.)(.)(.)(.)(.)(.)(.)(.)(.)(.)(.)/g, "abcdefghijkl", "$11$10$1$01$011$12$100"],
+    [/x*/g, "abc", "[$&]"],
+    [/\b/g, "one two", "|"],
+    [/(o)/gi, "fOo bOO", "$1$1"],
+    [/(\w+)@(\w+)\.com/g, "Mail bob@example.com or amy@test.com today", "$2:$1"],
+    [/(?:)/g, "", "$&!"],
+    [/(\u0416+)/g, "a\u0416\u0416b\u0416", "($1)"],
+    [/(\d)/, "a1b2", "<$1$1>"],
+    [/(\d)/y, "1b2", "<$1>"],
+];
+
+var matchCases = [
+    [/\w/g, "ab c"],
+    [/\w\w?/g, "abc de f"],
+    [/x*/g, "axxb"],
+    [/[\s\S]{3}/g, "abcdefgh"],
+    [/\u0416./g, "\u0416a\u0416\u0416b"],
+];
+
+var tests = [
+    {
+        name: "Global replace with a replacement string",
+        body: function () {
+            for (var i = 0; i < replaceCases.length; i++) {
+                var re = replaceCases[i][0];
+                var input = replaceCases[i][1];
+                var replacement = replaceCases[i][2];
+                var desc = re + " on " + JSON.stringify(input) + " with " + JSON.stringify(replacement);
+                var expected = input.replace(new SubRegExp(re.source, re.flags), replacement);
+                re.lastIndex = 0;
+                assert.areEqual(expected, input.replace(re, replacement), desc);
+            }
+        }
+    },
+    {
+        name: "The legacy RegExp statics still reflect the last match of a global replace",
+        body: function () {
+            "a1b22c333".replace(/(\d+)/g, "#$1#");
+            assert.areEqual("333", RegExp.lastMatch, "RegExp.lastMatch");
+            assert.areEqual("333", RegExp.$1, "RegExp.$1");
+            assert.areEqual("a1b22c", RegExp.leftContext, "RegExp.leftContext");
+        }
+    },
+    {
+        name: "Global match",
+        body: function () {
+            for (var i = 0; i < matchCases.length; i++) {
+                var re = matchCases[i][0];
+                var input = matchCases[i][1];
+                var desc = re + " on " + JSON.stringify(input);
+                var result = input.match(re);
+                assert.areEqual(input.match(new SubRegExp(re.source, re.flags)), result, desc);
+                for (var j = 0; j < result.length; j++) {
+                    assert.areEqual("string", typeof result[j], desc + " typeof " + j);
+                }
+            }
+        }
+    },
+    {
+        name: "Split",
+        body: function () {
+            assert.areEqual(["a", "1", undefined, "b", "2", "2", "c"], "a1b22c".split(/(\d)(\d)?/), "split with groups");
+            assert.areEqual(["a", "b"], "a,b,c".split(/,/, 2), "split limit");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,97 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Script contexts of the same runtime share compiled regex programs. Each context must still have its own regex
+// objects, lastIndex and match results, and a program must only be shared between regexes with the same flags.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function describe(result) {
+    return result === null ? "null" : JSON.stringify(result) + "@" + result.index;
+}
+
+var sources = [
+    "(\\d+)-(\\d+)",
+    "^(?:GET|POST) (\\/\\w*)",
+    "\\bcat\\b",
+    "[a-z]+@[a-z]+\\.com",
+    "(a+)+b",
+    "x*",
+];
+var flagSets = ["", "g", "i", "gi", "m", "y", "u"];
+var inputs = ["12-34 56-78", "GET /index", "concatenate cat", "Mail bob@example.com", "aaab aab", "", "CAT Cat"];
+
+// Build the same regexes, both as literals and with the RegExp constructor, in this and in another script context. The
+// other context is created first, since programs are only shared once the runtime has more than one script context.
+var code = "var literals = [" + sources.map(function (s) {
+    return flagSets.map(function (f) { return "/" + s + "/" + f; }).join(", ");
+}).join(", ") + "];";
+var other = WScript.LoadScript(code, "samethread");
+eval(code);
+
+var tests = [
+    {
+        name: "Regexes with the same source and flags match the same in every context",
+        body: function () {
+            var k = 0;
+            for (var i = 0; i < sources.length; i++) {
+                for (var j = 0; j < flagSets.length; j++, k++) {
+                    var local = literals[k];
+                    var remote = other.literals[k];
+                    var dynamicLocal = new RegExp(sources[i], flagSets[j]);
+                    var dynamicRemote = new other.RegExp(sources[i], flagSets[j]);
+
+                    assert.areEqual(local.flags, remote.flags, "flags of " + local);
+                    assert.areEqual(local.source, remote.source, "source of " + local);
+                    for (var n = 0; n < inputs.length; n++) {
+                        local.lastIndex = remote.lastIndex = dynamicLocal.lastIndex = dynamicRemote.lastIndex = 0;
+                        var expected = describe(local.exec(inputs[n]));
+                        var desc = local + " on " + JSON.stringify(inputs[n]);
+                        assert.areEqual(expected, describe(remote.exec(inputs[n])), desc + " (other context)");
+                        assert.areEqual(expected, describe(dynamicLocal.exec(inputs[n])), desc + " (RegExp)");
+                        assert.areEqual(expected, describe(dynamicRemote.exec(inputs[n])), desc + " (other context, RegExp)");
+                        assert.areEqual(local.lastIndex, remote.lastIndex, desc + " lastIndex");
+                    }
+                }
+            }
+        }
+    },
+    {
+        name: "Matching in one context leaves the other's state alone",
+        body: function () {
+            var mine = /o/g;
+            var theirs = other.eval("/o/g");
+            mine.exec("foo");
+            mine.exec("foo");
+            assert.areEqual(3, mine.lastIndex, "lastIndex here");
+            assert.areEqual(0, theirs.lastIndex, "lastIndex there");
+            theirs.exec("foo");
+            assert.areEqual(2, theirs.lastIndex, "lastIndex there after exec");
+            assert.areEqual(3, mine.lastIndex, "lastIndex here after exec there");
+
+            "xay".replace(/a/, "b");
+            other.eval("'x1y'.replace(/\\d/, 'b')");
+            assert.areEqual("a", RegExp.lastMatch, "RegExp.lastMatch here");
+            assert.areEqual("1", other.RegExp.lastMatch, "RegExp.lastMatch there");
+        }
+    },
+    {
+        name: "Invalid sources still throw in each context",
+        body: function () {
+            assert.throws(function () { new RegExp("("); }, SyntaxError, "Invalid source here");
+
+            // The other context's error fails assert.throws' instanceof Object check, so test its type directly
+            var error;
+            try {
+                other.eval("new RegExp('(')");
+            } catch (e) {
+                error = e;
+            }
+            assert.isTrue(error instanceof other.SyntaxError, "Invalid source in the other context");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,22 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Nothing is shared while this is the only script context
+var first = new RegExp("a+b", "g");
+
+var other = WScript.LoadScript("", "samethread");
+
+// Compiled once and then found by the other context, and by a literal here
+var a = new RegExp("(\\d+)-(\\d+)", "g");
+var b = new other.RegExp("(\\d+)-(\\d+)", "g");
+var c = eval("/(\\d+)-(\\d+)/g");
+
+// Different flags make a different program
+var d = new RegExp("(\\d+)-(\\d+)", "m");
+
+// Compiled before there was anything to share with, so shared now
+var e = new other.RegExp("a+b", "g");
+
+WScript.Echo(a.exec("12-34")[2], b.exec("5-6")[1], c.exec("7-8")[0], d.test("1-2"), e.test("aab"));
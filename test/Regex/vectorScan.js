@@ -0,0 +1,71 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Sync instructions may scan the input for match candidates several characters at a time. Put the only match at
+// every position of inputs of various lengths, so that it falls into each lane of a vector step and into the scalar
+// tail, and check that it is found exactly there.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var cases = [
+    // [regex, match, filler that cannot be part of a match]
+    [/x\d/, "x7", "a"],
+    [/[xy]\d/, "y7", "a"],
+    [/[0-9a-f]{4}-/, "0b3f-", "z"],
+    [/[^a-z ]\d/, "#1", "q "],
+    [/[\u0400-\u04ff]+!/, "\u0416\u0416!", "\u00e9"],
+    [/[\uff00-\uffff]/, "\uffff", "\u00ff"],
+    [/[^\u0000-\ufffe]/, "\uffff", "\u8000"],
+    [/\d+\.\d+/, "3.14", "x"],
+    [/ab\d/, "ab1", "a"],
+    [/abc\d/, "abc1", "ab"],
+    [/disk full/, "disk full", "disk ful"],
+    [/ERROR: \w+/, "ERROR: Disk", " ERROR"],
+    [/a longer literal than a vector step/, "a longer literal than a vector step", "a longer "],
+    [/\w+ (?:ERROR|WARN|FATAL)/, "db FATAL", " -"],
+    [/(?:err|warn)\d/i, "WaRn9", "warn "],
+    [/\d(?:ab|cd)/, "1cd", "ab c"],
+];
+
+function repeat(s, n) {
+    var result = "";
+    while (result.length < n) {
+        result += s;
+    }
+    return result.substring(0, n);
+}
+
+var tests = [
+    {
+        name: "The only match is found at every position",
+        body: function () {
+            for (var i = 0; i < cases.length; i++) {
+                var re = cases[i][0];
+                var match = cases[i][1];
+                var filler = cases[i][2];
+                for (var before = 0; before <= 40; before++) {
+                    for (var after = 0; after <= 20; after += 3) {
+                        var input = repeat(filler, before) + match + repeat(filler, after);
+                        var m = re.exec(input);
+                        var desc = re + " with " + before + " before and " + after + " after";
+                        assert.areEqual(match + "@" + before, m === null ? "null" : m[0] + "@" + m.index, desc);
+                        assert.isFalse(re.test(repeat(filler, before + after)), desc + " (no match)");
+                    }
+                }
+            }
+        }
+    },
+    {
+        name: "Global matching syncs again from lastIndex after each match",
+        body: function () {
+            var log = repeat("ok ", 50) + "ERROR: one" + repeat(" ok", 30) + " ERROR: two " + repeat("ok ", 9) + "ERROR: three";
+            assert.areEqual("ERROR: one,ERROR: two,ERROR: three", log.match(/ERROR: \w+/g).join(), "global");
+            assert.areEqual("one,two,three", log.replace(/ok /g, "").match(/(?:one|two|three)/g).join(), "global literals");
+            assert.areEqual("1,22,333", "a1bb22ccc333".match(/\d+/g).join(), "global set");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
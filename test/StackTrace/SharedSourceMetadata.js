@@ -0,0 +1,42 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+//
+// Script contexts of the same runtime loading identical source share its line offset cache.
+// Line and column information must stay correct for every context, and for a source of the
+// same length that differs in its line breaks.
+//
+
+var source =
+    "var unused = 0;\n" +
+    "\n" +
+    "function thrower() {\n" +
+    "    throw new Error('thrown');\n" +
+    "}\n";
+
+var sameLengthSource =
+    "var unused = 0; \n" +
+    "function thrower() {\n" +
+    "\n" +
+    "    throw new Error('thrown');\n" +
+    "}";
+
+function location(context)
+{
+    try {
+        context.thrower();
+    } catch (e) {
+        var match = /at thrower \(.*:(\d+):(\d+)\)/.exec(e.stack);
+        return match ? match[1] + ":" + match[2] : "no location";
+    }
+    return "no exception";
+}
+
+for (var i = 0; i < 3; i++) {
+    WScript.Echo("context " + i + ": " + location(WScript.LoadScript(source, "samethread")));
+}
+
+WScript.Echo("same length source: " + location(WScript.LoadScript(sameLengthSource, "samethread")));
+WScript.Echo("original source again: " + location(WScript.LoadScript(source, "samethread")));
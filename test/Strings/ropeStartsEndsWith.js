@@ -0,0 +1,59 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// startsWith / endsWith compare against unflattened concat trees in place; the results must match
+// those on the equivalent flat string, including for matches that straddle pieces.
+
+function referenceStartsWith(s, search, position) {
+    return s.slice(position, position + search.length) === search && position + search.length <= s.length;
+}
+
+function referenceEndsWith(s, search, end) {
+    return end - search.length >= 0 && s.slice(end - search.length, end) === search;
+}
+
+function build(kind, parts) {
+    switch (kind) {
+        case 0: return parts[0] + parts[1];
+        case 1: return parts[0] + parts[1] + parts[2];
+        case 2: return `<${parts[0]}>${parts[1]}</${parts[2]}>`;
+        case 3: return (parts[0] + parts[1]) + (parts[2] + parts[0]);
+        case 4: return [parts[0], parts[1], parts[2]].join("");
+        case 5:
+            var s = "";
+            for (var i = 0; i < 40; i++) {
+                s = s + parts[i % 3];
+            }
+            return s;
+    }
+}
+
+var parts = ["ab", "cde", "\uD83D\uDE00f"];
+var failures = 0;
+
+for (var kind = 0; kind <= 5; kind++) {
+    var s = build(kind, parts);
+    var flat = s.split("").join("");
+    for (var start = 0; start <= flat.length; start++) {
+        for (var len = 0; len <= 6 && start + len <= flat.length; len++) {
+            var hit = flat.substr(start, len);
+            var miss = hit.length ? hit.slice(0, -1) + "#" : "#";
+            [hit, miss].forEach(function (search) {
+                var tree = build(kind, parts);
+                if (tree.startsWith(search, start) !== referenceStartsWith(flat, search, start)) {
+                    failures++;
+                    WScript.Echo("startsWith", kind, JSON.stringify(search), start);
+                }
+                tree = build(kind, parts);
+                if (tree.endsWith(search, start) !== referenceEndsWith(flat, search, start)) {
+                    failures++;
+                    WScript.Echo("endsWith", kind, JSON.stringify(search), start);
+                }
+            });
+        }
+    }
+}
+
+WScript.Echo(failures === 0 ? "pass" : "fail");
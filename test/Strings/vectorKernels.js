@@ -0,0 +1,73 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// indexOf, includes and toUpperCase / toLowerCase process 8 characters at a time where SSE2 is
+// available. Check them against character-by-character references at every length and alignment
+// around the block size, including non-ASCII characters and characters that differ only in the high byte.
+
+var failures = 0;
+function check(actual, expected, what) {
+    if (actual !== expected) {
+        failures++;
+        WScript.Echo("FAIL", what, JSON.stringify(actual), JSON.stringify(expected));
+    }
+}
+
+function referenceIndexOf(s, search, position) {
+    for (var i = position; i + search.length <= s.length; i++) {
+        var j = 0;
+        while (j < search.length && s.charCodeAt(i + j) === search.charCodeAt(j)) {
+            j++;
+        }
+        if (j === search.length) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+function referenceCase(s, upper) {
+    var result = "";
+    for (var i = 0; i < s.length; i++) {
+        var c = s.charCodeAt(i);
+        if (upper && c >= 0x61 && c <= 0x7A) {
+            c -= 32;
+        } else if (!upper && c >= 0x41 && c <= 0x5A) {
+            c += 32;
+        }
+        result += String.fromCharCode(c);
+    }
+    return result;
+}
+
+var filler = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789@[`{";
+for (var length = 0; length <= 40; length++) {
+    var base = filler.substr(length % 7, length);
+    for (var pos = 0; pos <= length; pos++) {
+        // indexOf of a single character, and of a character whose low byte matches the target
+        var s = base.substr(0, pos) + "#" + base.substr(pos);
+        check(s.indexOf("#"), pos, "indexOf(#) " + s);
+        check(s.indexOf("#", pos + 1), -1, "indexOf(#, after) " + s);
+        var t = base.substr(0, pos) + "\u0123" + base.substr(pos);
+        check(t.indexOf("#"), -1, "indexOf(#) high byte " + t);
+        check(t.indexOf("\u0123"), pos, "indexOf(\\u0123) " + t);
+
+        // Multi-character searches whose first character recurs before the match
+        var u = base.substr(0, pos) + "#-#-#+" + base.substr(pos);
+        check(u.indexOf("#-#+"), pos + 2, "indexOf(#-#+) " + u);
+        check(u.includes("#+#"), false, "includes(#+#) " + u);
+        check(u.split("#+").length, 2, "split(#+) " + u);
+
+        // Case conversion, with and without a non-ASCII character at each position
+        check(base.toUpperCase(), referenceCase(base, true), "toUpperCase " + base);
+        check(base.toLowerCase(), referenceCase(base, false), "toLowerCase " + base);
+        var v = base.substr(0, pos) + "\u00E9" + base.substr(pos);
+        check(v.toUpperCase(), base.substr(0, pos).toUpperCase() + "\u00C9" + base.substr(pos).toUpperCase(), "toUpperCase non-ASCII " + v);
+        check(v.toLowerCase(), base.substr(0, pos).toLowerCase() + "\u00E9" + base.substr(pos).toLowerCase(), "toLowerCase non-ASCII " + v);
+        check(referenceIndexOf(u, "#-#+", 0), u.indexOf("#-#+"), "reference " + u);
+    }
+}
+
+WScript.Echo(failures === 0 ? "pass" : "fail");
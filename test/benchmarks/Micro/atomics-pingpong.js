@@ -0,0 +1,42 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Measures the round trip latency of Atomics.wait and Atomics.notify between two agents: the main agent and a
+// worker take turns flipping a shared word and waking each other.
+// Run with: ch -ESSharedArrayBuffer -Test262 atomics-pingpong.js
+
+var rounds = 20000;
+var ia = new Int32Array(new SharedArrayBuffer(Int32Array.BYTES_PER_ELEMENT));
+
+$262.agent.start(`
+$262.agent.receiveBroadcast(function (sab) {
+    var ia = new Int32Array(sab);
+    for (var i = 0; i < ${rounds}; i++) {
+        // Wait for the main agent's turn to end, then hand the turn back
+        while (Atomics.load(ia, 0) === 0) {
+            Atomics.wait(ia, 0, 0);
+        }
+        Atomics.store(ia, 0, 0);
+        Atomics.notify(ia, 0);
+    }
+    $262.agent.leaving();
+});
+`);
+$262.agent.broadcast(ia.buffer);
+
+var start = new Date();
+for (var i = 0; i < rounds; i++)
+{
+    Atomics.store(ia, 0, 1);
+    Atomics.notify(ia, 0);
+    while (Atomics.load(ia, 0) === 1)
+    {
+        Atomics.wait(ia, 0, 1);
+    }
+}
+var interval = new Date() - start;
+
+WScript.Echo("### TIME:", interval, "ms");
+WScript.Echo("### ROUND TRIP:", (interval * 1000 / rounds).toFixed(2), "us");
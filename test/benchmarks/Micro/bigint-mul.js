@@ -0,0 +1,36 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Measures BigInt multiplication of operands from a few hundred to several thousand bits, balanced and
+// unbalanced, plus the additions and subtractions around them.
+// BigInt is behind a flag, so this is not in the perftest.pl -micro list; run it as: ch -ESBigInt bigint-mul.js
+
+var iterations = 200;
+
+var small = eval('1234567890'.repeat(8) + 'n');         // ~270 bits
+var medium = eval('9876543210'.repeat(60) + 'n');       // ~2000 bits
+var large = eval('3141592653'.repeat(600) + 'n');       // ~20000 bits
+
+var check = 0n;
+var start = new Date();
+for (var i = 0; i < iterations; i++)
+{
+    var x = large * large;
+    var y = large * medium;
+    var z = medium * medium;
+    for (var j = 0; j < 50; j++)
+    {
+        z = z * small + medium;
+    }
+    check = check + (x - y) + z;
+}
+var interval = new Date() - start;
+
+if (check == 0n)
+{
+    throw new Error("Unexpected result");
+}
+
+WScript.Echo("### TIME:", interval, "ms");
@@ -0,0 +1,27 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Measures script context creation throughput: each iteration creates a new context in the
+// current runtime and touches a few commonly used built-ins, similar to what a host does when
+// it creates one context per request.
+
+var iterations = 500;
+var source = "var o = { a: 1, b: [1, 2, 3] };" +
+             "Object.prototype.toString.call(o);" +
+             "JSON.stringify(o);" +
+             "o.b.map(function (x) { return x + 1; }).join(',');";
+
+var start = new Date();
+for (var i = 0; i < iterations; i++)
+{
+    var global = WScript.LoadScript(source, "samethread");
+    if (global.o.a !== 1)
+    {
+        throw new Error("Unexpected result from new context");
+    }
+}
+var interval = new Date() - start;
+
+WScript.Echo("### TIME:", interval, "ms");
@@ -0,0 +1,55 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Measures template-heavy HTML generation: pages are assembled from template literals and
+// concatenation, then checked with startsWith / endsWith before being flattened once for output,
+// the way a server-side renderer inspects and emits its result.
+
+var iterations = 300;
+var rows = [];
+for (var i = 0; i < 200; i++)
+{
+    rows.push({ id: i, name: "item-" + i, price: (i * 1.25).toFixed(2), tags: ["a", "b", "c"].slice(0, i % 4) });
+}
+
+function renderRow(row)
+{
+    return `<tr id="row-${row.id}"><td class="name">${row.name}</td><td class="price">${row.price}</td>` +
+           `<td>${row.tags.map(function (t) { return `<span class="tag">${t}</span>`; }).join("")}</td></tr>`;
+}
+
+function renderPage(title, rows)
+{
+    var body = "";
+    for (var i = 0; i < rows.length; i++)
+    {
+        body += renderRow(rows[i]);
+    }
+    return `<!DOCTYPE html><html><head><title>${title}</title></head><body><table>` + body + `</table></body></html>`;
+}
+
+var checksum = 0;
+var start = new Date();
+for (var i = 0; i < iterations; i++)
+{
+    var page = renderPage("page " + i, rows);
+    if (!page.startsWith("<!DOCTYPE html>") || !page.endsWith("</html>"))
+    {
+        throw new Error("Unexpected page shape");
+    }
+    if (i % 10 === 0)
+    {
+        // Occasionally emit the page, which flattens it
+        checksum += page.charCodeAt(page.length >> 1);
+    }
+}
+var interval = new Date() - start;
+
+if (checksum === 0)
+{
+    throw new Error("Unexpected checksum");
+}
+
+WScript.Echo("### TIME:", interval, "ms");
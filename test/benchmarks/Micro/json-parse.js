@@ -0,0 +1,87 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Measures JSON.parse throughput on generated documents shaped like the usual JSON corpora:
+//   - "twitter": many objects with string-heavy fields, some escapes and non-ASCII text
+//   - "citm":    deep maps keyed by numeric ids with small integer arrays
+//   - "canada":  long arrays of floating point coordinate pairs
+
+if (typeof (WScript) === "undefined")
+{
+    var WScript = {
+        Echo: print
+    }
+}
+
+function makeTwitter(count)
+{
+    var statuses = [];
+    for (var i = 0; i < count; i++)
+    {
+        statuses.push({
+            id: 505874924095815700 + i,
+            text: "@user" + i + " \u3053\u3093\u306b\u3061\u306f - this is a \"quoted\" status update number " + i + "\nhttp://example.com/" + i,
+            source: "<a href=\"http://twitter.com/download/iphone\" rel=\"nofollow\">Twitter for iPhone</a>",
+            truncated: false,
+            user: {
+                id: 1186275104 + i,
+                name: "user name " + i,
+                screen_name: "screen_" + i,
+                location: "",
+                description: "A fairly long profile description that contains only plain characters and no escapes at all " + i,
+                followers_count: i * 7,
+                verified: (i % 11) === 0
+            },
+            entities: { hashtags: [], urls: [], user_mentions: [{ screen_name: "other" + i, indices: [0, 9] }] },
+            retweet_count: i % 100,
+            favorited: false,
+            lang: "ja"
+        });
+    }
+    return JSON.stringify({ statuses: statuses });
+}
+
+function makeCitm(count)
+{
+    var events = {};
+    for (var i = 0; i < count; i++)
+    {
+        events[138586341 + i] = {
+            description: null,
+            id: 138586341 + i,
+            logo: "/images/UE0AAAAACEKo6QAAAAZDSVRN",
+            name: "Event " + i,
+            subTopicIds: [337184269, 337184283 + (i % 5)],
+            subjectCode: null,
+            subtitle: null,
+            topicIds: [324846099, 107888604 + (i % 3)]
+        };
+    }
+    return JSON.stringify({ events: events });
+}
+
+function makeCanada(count)
+{
+    var coordinates = [];
+    for (var i = 0; i < count; i++)
+    {
+        coordinates.push([-65.613616999999977 + i / 1000, 43.420273000000009 - i / 3000]);
+    }
+    return JSON.stringify({ type: "FeatureCollection", features: [{ type: "Feature", geometry: { type: "Polygon", coordinates: [coordinates] } }] });
+}
+
+var documents = [makeTwitter(2000), makeCitm(5000), makeCanada(50000)];
+
+var start = new Date();
+for (var iteration = 0; iteration < 10; iteration++)
+{
+    for (var i = 0; i < documents.length; i++)
+    {
+        JSON.parse(documents[i]);
+    }
+}
+var interval = new Date() - start;
+
+WScript.Echo("### TIME:", interval, "ms");
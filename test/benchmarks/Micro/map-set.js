@@ -0,0 +1,57 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Measures Map and Set used as caches: filling with int and string keys, lookups, iteration, and
+// deleting and re-adding a sliding window of keys, which leaves holes for the entry storage to compact.
+
+var iterations = 10;
+var size = 100000;
+
+var stringKeys = [];
+for (var i = 0; i < size; i++)
+{
+    stringKeys.push("key" + i);
+}
+
+var count = 0;
+var start = new Date();
+for (var iter = 0; iter < iterations; iter++)
+{
+    var map = new Map();
+    var set = new Set();
+    for (var i = 0; i < size; i++)
+    {
+        map.set(stringKeys[i], i);
+        set.add(i);
+    }
+
+    for (var i = 0; i < size; i++)
+    {
+        count += map.get(stringKeys[i]);
+        count += set.has(i * 2) ? 1 : 0;
+    }
+
+    map.forEach(function (value) { count += value; });
+    for (var value of set)
+    {
+        count += value;
+    }
+
+    // Evict the oldest entries and insert new ones, the way an LRU-ish cache would
+    for (var i = 0; i < size; i++)
+    {
+        map.delete(stringKeys[i]);
+        map.set(stringKeys[(i + size / 2) % size] + "x", i);
+    }
+    count += map.size;
+}
+var interval = new Date() - start;
+
+if (count === 0)
+{
+    throw new Error("Unexpected result");
+}
+
+WScript.Echo("### TIME:", interval, "ms");
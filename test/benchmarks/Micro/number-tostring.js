@@ -0,0 +1,42 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Measures number to string and string to number conversion:
+//   - short decimals such as prices and coordinates, the common case in JSON
+//   - values needing 16 or 17 significant digits, such as the results of divisions
+//   - JSON.stringify and JSON.parse of numeric arrays
+
+if (typeof (WScript) === "undefined")
+{
+    var WScript = {
+        Echo: print
+    }
+}
+
+var shortDecimals = [];
+var longDecimals = [];
+for (var i = 0; i < 10000; i++)
+{
+    shortDecimals.push((i * 37 % 100000) / 100);
+    longDecimals.push(i / 7 + 0.1);
+}
+
+var start = new Date();
+var length = 0;
+for (var iteration = 0; iteration < 20; iteration++)
+{
+    for (var i = 0; i < shortDecimals.length; i++)
+    {
+        length += String(shortDecimals[i]).length;
+        length += String(longDecimals[i]).length;
+    }
+
+    var json = JSON.stringify(shortDecimals) + JSON.stringify(longDecimals);
+    length += json.length;
+    length += JSON.parse(JSON.stringify(longDecimals)).length;
+}
+var interval = new Date() - start;
+
+WScript.Echo("### TIME:", interval, "ms");
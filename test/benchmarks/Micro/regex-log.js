@@ -0,0 +1,50 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Measures regexes of the kind used to parse logs and route requests, run many times on short inputs:
+//   - anchored field extraction with capturing groups
+//   - unanchored searches for a keyword followed by a value
+//   - global tokenization of a line
+
+if (typeof (WScript) === "undefined")
+{
+    var WScript = {
+        Echo: print
+    }
+}
+
+var lines = [];
+for (var i = 0; i < 1000; i++)
+{
+    lines.push("2024-01-" + (10 + i % 20) + " 12:" + (10 + i % 50) + ":07 GET /api/v" + (i % 3) + "/items/" + i +
+        " status=" + (200 + (i % 5) * 100) + " time=" + (i % 97) + "ms");
+}
+
+var route = /^(\d+)-(\d+)-(\d+) (\d+):(\d+):(\d+) GET \/api\/v(\d)\/(\w+)\/(\d+)/;
+var status = /status=(\d+)/;
+var token = /\w+/g;
+
+var start = new Date();
+var count = 0;
+for (var iteration = 0; iteration < 50; iteration++)
+{
+    for (var i = 0; i < lines.length; i++)
+    {
+        var line = lines[i];
+        var m = route.exec(line);
+        if (m !== null)
+        {
+            count += m.length;
+        }
+        if (status.test(line))
+        {
+            count++;
+        }
+        count += line.match(token).length;
+    }
+}
+var interval = new Date() - start;
+
+WScript.Echo("### TIME:", interval, "ms");
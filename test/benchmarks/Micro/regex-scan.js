@@ -0,0 +1,45 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Measures regexes that search long log text in which matches are rare, so that most of the time goes into
+// skipping input that cannot start a match:
+//   - a keyword literal
+//   - one of several keywords
+//   - a character class
+//   - a case-insensitive keyword
+
+if (typeof (WScript) === "undefined")
+{
+    var WScript = {
+        Echo: print
+    }
+}
+
+var lines = [];
+for (var i = 0; i < 2000; i++)
+{
+    var level = i % 500 === 0 ? "FATAL" : (i % 100 === 0 ? "ERROR" : "info");
+    lines.push("2024-01-" + (10 + i % 20) + " " + level + " request handled for client session " + (i * 7919) +
+        " in worker pool " + (i % 16) + (i % 250 === 0 ? " [timeout]" : ""));
+}
+var log = lines.join("\n");
+
+var keyword = /FATAL/g;
+var keywords = /\b(?:ERROR|FATAL|PANIC)\b/g;
+var bracket = /\[[a-z]+\]/g;
+var ignoreCase = /timeout/gi;
+
+var start = new Date();
+var count = 0;
+for (var iteration = 0; iteration < 20; iteration++)
+{
+    count += log.match(keyword).length;
+    count += log.match(keywords).length;
+    count += log.match(bracket).length;
+    count += log.match(ignoreCase).length;
+}
+var interval = new Date() - start;
+
+WScript.Echo("### TIME:", interval, "ms");
@@ -0,0 +1,39 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Measures the String built-ins that scan or convert long flat strings: single and multi character
+// indexOf / includes, split on a string separator, and ASCII case conversion.
+
+var iterations = 200;
+
+var words = [];
+for (var i = 0; i < 4000; i++)
+{
+    words.push("token" + (i * 7919 % 10007) + "_value");
+}
+var text = words.join(" ");             // Long ASCII text without the needles below
+var csv = words.join(",");
+var mixedCase = text.replace(/o/g, "O");
+
+var count = 0;
+var start = new Date();
+for (var i = 0; i < iterations; i++)
+{
+    count += text.indexOf("#");
+    count += text.indexOf("t", text.length - 50);
+    count += text.includes("token10008") ? 1 : 0;
+    count += text.indexOf("value token9_") >= 0 ? 1 : 0;
+    count += csv.split(",").length;
+    count += mixedCase.toLowerCase().length;
+    count += mixedCase.toUpperCase().length;
+}
+var interval = new Date() - start;
+
+if (count === 0)
+{
+    throw new Error("Unexpected result");
+}
+
+WScript.Echo("### TIME:", interval, "ms");
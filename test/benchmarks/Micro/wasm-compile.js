@@ -0,0 +1,44 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Measures the time until a large WebAssembly module is ready for instantiation: decoding its sections, checking
+// its exports and setting up a function body for each of its functions. Every function is exported, under names
+// that all have the same length.
+
+if (typeof (WScript) === "undefined")
+{
+    var WScript = {
+        Echo: print
+    }
+}
+
+function buildModule(functionCount)
+{
+    var funcs = [];
+    for (var i = 0; i < functionCount; i++)
+    {
+        funcs.push("(func (export \"f" + (1000000 + i) + "\") (param i32) (result i32) (i32.add (get_local 0) (i32.const " + i + ")))");
+    }
+    return WebAssembly.wabt.convertWast2Wasm("(module " + funcs.join(" ") + ")");
+}
+
+var buffer = buildModule(20000);
+
+var start = new Date();
+var sum = 0;
+for (var iteration = 0; iteration < 5; iteration++)
+{
+    var module = new WebAssembly.Module(buffer);
+    sum += WebAssembly.Module.exports(module).length;
+}
+var interval = new Date() - start;
+
+var instance = new WebAssembly.Instance(module);
+if (sum !== 5 * 20000 || instance.exports.f1000123(1) !== 124)
+{
+    WScript.Echo("FAILED");
+}
+
+WScript.Echo("### TIME:", interval, "ms");
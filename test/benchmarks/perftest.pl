@@ -587,6 +587,7 @@ sub usage
     print "  -kraken                Run the kraken benchmark\n";
     print "  -octane                Run the Octane 2.0 benchmark\n";
     print "  -jetstream             Run the JetStream benchmark (only non octane and sunspider tests)\n";
+    print "  -micro                 Run the runtime micro benchmarks (context creation, etc.)\n";
     print "  -file:<file>           Run the specified js file\n";
     print "  -args:<other args>     Other arguments to ch.exe\n";
     print "  -score                 Test output scores\n";
@@ -735,6 +736,15 @@ sub parse_args
             $testfile = "perftest$dir.txt";
             $is_dynamicProfileRun = 1;
         }
+        elsif($ARGV[$i] =~ /[-\/]micro/i)
+        {
+            @testlist = ("context-create", "html-template", "json-parse", "map-set", "number-tostring", "regex-log", "regex-scan", "string-ops", "wasm-compile");
+            $testDescription = "runtime micro benchmarks";
+            $dir = "Micro";
+            $basefile = "perfbase$dir.txt";
+            $testfile = "perftest$dir.txt";
+            $is_dynamicProfileRun = 0;
+        }
         elsif($ARGV[$i] =~ /[-\/]file:(.*).js$/i)
         {
             # only supports octane, add additional support here for jetstream
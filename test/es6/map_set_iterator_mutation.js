@@ -0,0 +1,152 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Iterators over Map and Set have to keep their position while the collection grows, drops entries
+// and gets cleared underneath them.
+
+function assert(condition, message)
+{
+    if (!condition)
+    {
+        throw new Error(message);
+    }
+}
+
+function assertSequence(actual, expected, message)
+{
+    assert(actual.length === expected.length, message + ": got " + actual.join(","));
+    for (var i = 0; i < expected.length; i++)
+    {
+        assert(actual[i] === expected[i], message + ": got " + actual.join(","));
+    }
+}
+
+// Deleting most entries ahead of and behind a live iterator, then adding enough to force the storage
+// to be rebuilt, keeps the iterator on the next live entry
+{
+    var map = new Map();
+    for (var i = 0; i < 100; i++)
+    {
+        map.set(i, "v" + i);
+    }
+    var it = map.keys();
+    var seen = [];
+    for (var i = 0; i < 10; i++)
+    {
+        seen.push(it.next().value);
+    }
+    for (var i = 0; i < 100; i++)
+    {
+        if (i % 10 !== 0)
+        {
+            map.delete(i);
+        }
+    }
+    for (var i = 100; i < 200; i++)
+    {
+        map.set(i, "v" + i);
+    }
+    for (var r = it.next(); !r.done; r = it.next())
+    {
+        seen.push(r.value);
+    }
+    var expected = [0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 20, 30, 40, 50, 60, 70, 80, 90];
+    for (var i = 100; i < 200; i++)
+    {
+        expected.push(i);
+    }
+    assertSequence(seen, expected, "map iterator across compaction");
+    assert(map.get(150) === "v150" && map.get(40) === "v40" && !map.has(41), "map lookups after compaction");
+    assert(map.size === 110, "map size after compaction");
+}
+
+// Sliding window: the same key set is deleted and re-added many times
+{
+    var set = new Set();
+    for (var i = 0; i < 1000; i++)
+    {
+        set.add("k" + i);
+        if (i >= 50)
+        {
+            set.delete("k" + (i - 50));
+        }
+    }
+    assert(set.size === 50, "set size after sliding window");
+    var values = [];
+    set.forEach(function (v) { values.push(v); });
+    var expected = [];
+    for (var i = 950; i < 1000; i++)
+    {
+        expected.push("k" + i);
+    }
+    assertSequence(values, expected, "set order after sliding window");
+}
+
+// An iterator created on an empty set sees entries added later
+{
+    var set = new Set();
+    var it = set.values();
+    set.add(1);
+    set.add(2);
+    assertSequence([it.next().value, it.next().value], [1, 2], "iterator created on empty set");
+    assert(it.next().done, "iterator done");
+    set.add(3);
+    assert(it.next().done, "finished iterator stays done");
+}
+
+// Clear during iteration continues with the entries added after the clear
+{
+    var map = new Map([[1, 1], [2, 2], [3, 3]]);
+    var seen = [];
+    map.forEach(function (value, key)
+    {
+        seen.push(key);
+        if (key === 2)
+        {
+            map.clear();
+            map.set(10, 10);
+            map.set(11, 11);
+        }
+    });
+    assertSequence(seen, [1, 2, 10, 11], "forEach across clear");
+}
+
+// Deleting and re-adding an entry moves it to the end, so a live iterator visits it again
+{
+    var set = new Set([1, 2, 3]);
+    var seen = [];
+    for (var v of set)
+    {
+        seen.push(v);
+        if (seen.length === 1)
+        {
+            set.delete(1);
+            set.add(1);
+        }
+    }
+    assertSequence(seen, [1, 2, 3, 1], "re-added entry visited again");
+}
+
+// Int sets promoted to var sets by a delete, then compacted
+{
+    var set = new Set();
+    for (var i = 0; i < 64; i++)
+    {
+        set.add(i);
+    }
+    for (var i = 0; i < 60; i++)
+    {
+        set.delete(i);
+    }
+    for (var i = 100; i < 200; i++)
+    {
+        set.add(i);
+    }
+    assert(set.has(63) && set.has(150) && !set.has(10), "set lookups after compaction");
+    var values = Array.from(set);
+    assert(values.length === 104 && values[0] === 60 && values[4] === 100 && values[103] === 199, "set order after compaction");
+}
+
+WScript.Echo("pass");
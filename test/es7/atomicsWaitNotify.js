@@ -0,0 +1,74 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Atomics.wait suspends the calling agent until Atomics.notify wakes it or the timeout passes. Notify wakes no more
+// waiters than it is asked to and returns how many it woke.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function getReport() {
+    var r;
+    while ((r = $262.agent.getReport()) == null) {
+        $262.agent.sleep(10);
+    }
+    return r;
+}
+
+var tests = [
+    {
+        name: "Wait and notify without other agents",
+        body: function () {
+            var ia = new Int32Array(new SharedArrayBuffer(Int32Array.BYTES_PER_ELEMENT * 4));
+            assert.areEqual("not-equal", Atomics.wait(ia, 0, 1, 0), "not-equal");
+            assert.areEqual("timed-out", Atomics.wait(ia, 0, 0, 0), "zero timeout");
+            var start = Date.now();
+            assert.areEqual("timed-out", Atomics.wait(ia, 0, 0, 50), "timeout");
+            assert.isTrue(Date.now() - start >= 40, "waited for the timeout");
+            assert.areEqual(0, Atomics.notify(ia, 0), "notify without waiters");
+        }
+    },
+    {
+        name: "Notify wakes waiting agents one at a time",
+        body: function () {
+            var ia = new Int32Array(new SharedArrayBuffer(Int32Array.BYTES_PER_ELEMENT * 4));
+
+            // Agent 0 and 1 wait on ia[0] without a timeout, agent 2 waits on ia[1] until its timeout
+            for (var i = 0; i < 3; i++) {
+                $262.agent.start(`
+$262.agent.receiveBroadcast(function (sab) {
+    var ia = new Int32Array(sab);
+    if (${i} < 2) {
+        $262.agent.report("${i}:" + Atomics.wait(ia, 0, 0));
+    } else {
+        $262.agent.report("${i}:" + Atomics.wait(ia, 1, 0, 100));
+    }
+    $262.agent.leaving();
+});
+`);
+            }
+
+            $262.agent.broadcast(ia.buffer);
+
+            assert.areEqual("2:timed-out", getReport(), "timed out agent");
+
+            // Wake the two waiters one at a time, retrying until each has started waiting. Give up if they never do,
+            // which is what happens where Atomics.wait cannot block, rather than retrying forever.
+            var reports = [];
+            var start = Date.now();
+            while (reports.length < 2 && Date.now() - start < 10000) {
+                var n = Atomics.notify(ia, 0, 1);
+                assert.isTrue(n <= 1, "woken by one notify");
+                if (n === 1) {
+                    reports.push(getReport());
+                }
+                $262.agent.sleep(10);
+            }
+            assert.areEqual("0:ok,1:ok", reports.sort().join(), "woken agents");
+            assert.areEqual(0, Atomics.notify(ia, 0), "nobody left to wake");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
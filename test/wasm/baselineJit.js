@@ -0,0 +1,88 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// With the baseline JIT, WebAssembly functions are compiled without global optimizations on their first call and
+// recompiled with the full JIT once their baseline code is hot. Results must not change across the tiers, also when
+// several instances share the functions of one module.
+
+/* global assert,testRunner */ // eslint rule
+WScript.LoadScriptFile("../UnitTestFramework/UnitTestFramework.js");
+
+const mod = new WebAssembly.Module(WebAssembly.wabt.convertWast2Wasm(`
+(module
+  (memory 1)
+  ;; 1 + 2 + ... + n
+  (func $sum (export "sum") (param $n i32) (result i32) (local $total i32)
+    (block $done
+      (loop $next
+        (br_if $done (i32.eqz (get_local $n)))
+        (set_local $total (i32.add (get_local $total) (get_local $n)))
+        (set_local $n (i32.sub (get_local $n) (i32.const 1)))
+        (br $next)
+      )
+    )
+    (get_local $total)
+  )
+  (func (export "hypot") (param $a f64) (param $b f64) (result f64)
+    (f64.sqrt (f64.add (f64.mul (get_local $a) (get_local $a)) (f64.mul (get_local $b) (get_local $b))))
+  )
+  (func (export "store") (param $address i32) (param $value i32)
+    (i32.store (get_local $address) (get_local $value))
+  )
+  (func (export "load") (param $address i32) (result i32)
+    (i32.load (get_local $address))
+  )
+  ;; Through wasm to wasm calls
+  (func (export "twice") (param $n i32) (result i32)
+    (i32.add (call $sum (get_local $n)) (call $sum (get_local $n)))
+  )
+)`));
+
+const tests = [
+  {
+    name: "Results are the same in every tier, for every instance",
+    body() {
+      const instances = [new WebAssembly.Instance(mod), new WebAssembly.Instance(mod)];
+
+      // Enough calls to run each function in the interpreter, the baseline code and the fully optimized code
+      for (let i = 0; i < 200; ++i) {
+        for (let k = 0; k < instances.length; ++k) {
+          const {exports} = instances[k];
+          const n = (i * 7 + k) % 50;
+          const desc = ` call ${i} instance ${k}`;
+
+          assert.areEqual(n * (n + 1) / 2, exports.sum(n), "sum" + desc);
+          assert.areEqual(n * (n + 1), exports.twice(n), "twice" + desc);
+          assert.areEqual(5 * n, exports.hypot(3 * n, 4 * n), "hypot" + desc);
+
+          const address = (i % 64) * 4;
+          exports.store(address, i * 1000 + k);
+          assert.areEqual(i * 1000 + k, exports.load(address), "load" + desc);
+          assert.throws(() => exports.load(65536), WebAssembly.RuntimeError, "out of bounds load" + desc);
+        }
+      }
+
+      // Instances of the module have separate memories
+      assert.areEqual(192000, instances[0].exports.load(0), "memory of first instance");
+      assert.areEqual(192001, instances[1].exports.load(0), "memory of second instance");
+    }
+  },
+];
+
+WScript.LoadScriptFile("../UnitTestFramework/yargs.js");
+const argv = yargsParse(WScript.Arguments, {
+  boolean: ["verbose"],
+  number: ["start", "end"],
+  default: {
+    verbose: true,
+    start: 0,
+    end: tests.length
+  }
+}).argv;
+
+const todoTests = tests
+  .slice(argv.start, argv.end);
+
+testRunner.run(todoTests, {verbose: argv.verbose});
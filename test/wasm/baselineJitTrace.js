@@ -0,0 +1,23 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// The tiers a WebAssembly function goes through with the baseline JIT: scheduled for the baseline JIT on its first
+// call, and for the full JIT once its baseline code has run WasmBaselineJitTierUpCount times. Nothing else is printed,
+// so that the trace is the whole baseline.
+
+const {exports: {inc}} = new WebAssembly.Instance(new WebAssembly.Module(WebAssembly.wabt.convertWast2Wasm(`
+(module
+  (func (export "inc") (param i32) (result i32)
+    (i32.add (get_local 0) (i32.const 1))
+  )
+)`)));
+
+let value = 0;
+for (let i = 0; i < 20; ++i) {
+  value = inc(value);
+}
+if (value !== 20) {
+  throw new Error(`Expected 20, got ${value}`);
+}
@@ -0,0 +1,142 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// memory.copy and memory.fill check their whole range before writing anything, and memory.copy behaves like memmove
+// when the ranges overlap. Call the functions enough times to also run them in jitted code.
+
+/* global assert,testRunner */ // eslint rule
+WScript.LoadScriptFile("../UnitTestFramework/UnitTestFramework.js");
+WScript.LoadScriptFile("../WasmSpec/testsuite/harness/wasm-constants.js");
+WScript.LoadScriptFile("../WasmSpec/testsuite/harness/wasm-module-builder.js");
+
+// The bulk memory opcodes are not in the shared constants, and wabt is not built with bulk memory enabled
+const kNumericPrefix = 0xfc;
+const kExprMemoryCopy = 0x0a;
+const kExprMemoryFill = 0x0b;
+
+function buildModule(copyCode) {
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1);
+  // copy(dst, src, length)
+  builder.addFunction("copy", kSig_v_iii)
+    .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprGetLocal, 2].concat(copyCode))
+    .exportFunc();
+  // fill(dst, value, length)
+  builder.addFunction("fill", kSig_v_iii)
+    .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprGetLocal, 2, kNumericPrefix, kExprMemoryFill, 0])
+    .exportFunc();
+  // load8(address)
+  builder.addFunction("load8", kSig_i_i)
+    .addBody([kExprGetLocal, 0, kExprI32LoadMem8U, 0, 0])
+    .exportFunc();
+  // store8(address, value)
+  builder.addFunction("store8", kSig_v_ii)
+    .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprI32StoreMem8, 0, 0])
+    .exportFunc();
+  return builder.toBuffer();
+}
+
+const pageSize = 65536;
+
+function pattern(address, i) {
+  return (address * 7 + i) & 0xff;
+}
+
+const tests = [
+  {
+    name: "memory.copy and memory.fill in every tier",
+    body() {
+      const e = new WebAssembly.Instance(new WebAssembly.Module(buildModule([kNumericPrefix, kExprMemoryCopy, 0, 0]))).exports;
+
+      function writePattern(address, length, i) {
+        for (let k = 0; k < length; ++k) {
+          e.store8(address + k, pattern(address + k, i));
+        }
+      }
+
+      function readBytes(address, length) {
+        const bytes = [];
+        for (let k = 0; k < length; ++k) {
+          bytes.push(e.load8(address + k));
+        }
+        return bytes;
+      }
+
+      function patternBytes(patternAddress, length, i) {
+        const bytes = [];
+        for (let k = 0; k < length; ++k) {
+          bytes.push(pattern(patternAddress + k, i));
+        }
+        return bytes;
+      }
+
+      for (let i = 0; i < 100; ++i) {
+        const desc = " call " + i;
+        const length = 1 + (i * 13) % 97;
+        const shift = (i % 5) + 1;
+
+        // Fill, truncating the value to a byte
+        e.store8(1000 + length, 0xee);
+        e.fill(1000, 0x100 + i, length);
+        assert.areEqual(new Array(length).fill(i), readBytes(1000, length), "fill" + desc);
+        assert.areEqual(0xee, e.load8(1000 + length), "fill end" + desc);
+
+        // Disjoint copy
+        writePattern(2000, length, i);
+        e.copy(3000, 2000, length);
+        assert.areEqual(patternBytes(2000, length, i), readBytes(3000, length), "copy" + desc);
+
+        // Overlapping copies, forward and backward
+        writePattern(4000, length, i);
+        e.copy(4000 + shift, 4000, length);
+        assert.areEqual(patternBytes(4000, length, i), readBytes(4000 + shift, length), "overlapping copy forward" + desc);
+        writePattern(5000, length, i);
+        e.copy(5000, 5000 + shift, length);
+        assert.areEqual(patternBytes(5000 + shift, length - shift, i), readBytes(5000, length - shift), "overlapping copy backward" + desc);
+
+        // Ranges that end exactly at the end of the memory, and empty ranges
+        e.fill(pageSize - length, 0x5a, length);
+        assert.areEqual(0x5a, e.load8(pageSize - 1), "fill to end" + desc);
+        e.copy(pageSize - length, 0, length);
+        assert.areEqual(e.load8(0), e.load8(pageSize - length), "copy to end" + desc);
+        e.fill(pageSize, 0, 0);
+        e.copy(pageSize, pageSize, 0);
+
+        // Out of bounds ranges trap before anything is written
+        e.store8(pageSize - 1, 0x11);
+        assert.throws(() => e.fill(pageSize - 1, 0x22, length + 1), WebAssembly.RuntimeError, "fill past end" + desc);
+        assert.areEqual(0x11, e.load8(pageSize - 1), "fill past end writes nothing" + desc);
+        assert.throws(() => e.copy(pageSize - 1, 0, length + 1), WebAssembly.RuntimeError, "copy to past end" + desc);
+        assert.areEqual(0x11, e.load8(pageSize - 1), "copy to past end writes nothing" + desc);
+        assert.throws(() => e.copy(0, pageSize - length, length + 1), WebAssembly.RuntimeError, "copy from past end" + desc);
+        assert.throws(() => e.fill(pageSize + 1, 0, 0), WebAssembly.RuntimeError, "empty fill past end" + desc);
+        assert.throws(() => e.copy(0, -1, 2), WebAssembly.RuntimeError, "copy with wrapping range" + desc);
+        assert.throws(() => e.fill(1, 0, -1), WebAssembly.RuntimeError, "fill with huge length" + desc);
+      }
+    }
+  },
+  {
+    name: "The memory index after the opcode is reserved",
+    body() {
+      assert.throws(() => new WebAssembly.Module(buildModule([kNumericPrefix, kExprMemoryCopy, 0, 1])), WebAssembly.CompileError);
+    }
+  },
+];
+
+WScript.LoadScriptFile("../UnitTestFramework/yargs.js");
+const argv = yargsParse(WScript.Arguments, {
+  boolean: ["verbose"],
+  number: ["start", "end"],
+  default: {
+    verbose: true,
+    start: 0,
+    end: tests.length
+  }
+}).argv;
+
+const todoTests = tests
+  .slice(argv.start, argv.end);
+
+testRunner.run(todoTests, {verbose: argv.verbose});
@@ -0,0 +1,93 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Export names must be distinct. Check this for modules exporting many functions under names of the same length,
+// and for names that differ only after an embedded null character.
+
+/* global assert,testRunner */ // eslint rule
+WScript.LoadScriptFile("../UnitTestFramework/UnitTestFramework.js");
+
+// Each function returns its index; names[i] is the export name of function exportedFunctions[i]
+function moduleText(functionCount, names, exportedFunctions) {
+  const funcs = [];
+  for (let i = 0; i < functionCount; ++i) {
+    funcs.push(`(func (result i32) (i32.const ${i}))`);
+  }
+  const exports = names.map((name, i) => `(export "${name.replace(/\0/g, "\\00")}" (func ${exportedFunctions[i]}))`);
+  return `(module ${funcs.join(" ")} ${exports.join(" ")})`;
+}
+
+function compile(functionCount, names, exportedFunctions) {
+  const buf = WebAssembly.wabt.convertWast2Wasm(moduleText(functionCount, names, exportedFunctions));
+  return new WebAssembly.Module(buf);
+}
+
+// wabt would reject duplicate export names itself, so write the module as one which is expected to be invalid
+function assertInvalid(functionCount, names, exportedFunctions, msg) {
+  const {commands: [{buffer}]} = WebAssembly.wabt.convertWast2Wasm(
+    `(assert_invalid ${moduleText(functionCount, names, exportedFunctions)} "duplicate export")`, {spec: true});
+  assert.throws(() => new WebAssembly.Module(buffer), WebAssembly.CompileError, msg);
+}
+
+const count = 3000;
+const names = [];
+const indices = [];
+for (let i = 0; i < count; ++i) {
+  names.push("f" + (10000 + i));
+  indices.push(i);
+}
+
+const tests = [
+  {
+    name: "Many exports with names of the same length",
+    body() {
+      const mod = compile(count, names, indices);
+      const {exports} = new WebAssembly.Instance(mod);
+      assert.areEqual(0, exports.f10000(), "f10000");
+      assert.areEqual(1234, exports.f11234(), "f11234");
+      assert.areEqual(2999, exports.f12999(), "f12999");
+      assert.areEqual(count, WebAssembly.Module.exports(mod).length, "export count");
+    }
+  },
+  {
+    name: "Duplicate export names",
+    body() {
+      assertInvalid(count, names.concat(["f10000"]), indices.concat([5]), "duplicate last");
+      assertInvalid(count, ["f12999"].concat(names), [7].concat(indices), "duplicate first");
+      assertInvalid(3, ["a", "b", "a"], [0, 1, 2], "duplicate of another function's name");
+    }
+  },
+  {
+    name: "Several names for the same function",
+    body() {
+      const {exports} = new WebAssembly.Instance(compile(3, ["x", "y", "z"], [2, 2, 1]));
+      assert.areEqual([2, 2, 1], [exports.x(), exports.y(), exports.z()], "aliases");
+    }
+  },
+  {
+    name: "Names are compared in full, even past a null character",
+    body() {
+      const {exports} = new WebAssembly.Instance(compile(2, ["a\0b", "a\0c"], [0, 1]));
+      assert.areEqual([0, 1], [exports["a\0b"](), exports["a\0c"]()], "embedded null");
+      assertInvalid(2, ["a\0b", "a\0b"], [0, 1], "embedded null duplicate");
+    }
+  },
+];
+
+WScript.LoadScriptFile("../UnitTestFramework/yargs.js");
+const argv = yargsParse(WScript.Arguments, {
+  boolean: ["verbose"],
+  number: ["start", "end"],
+  default: {
+    verbose: true,
+    start: 0,
+    end: tests.length
+  }
+}).argv;
+
+const todoTests = tests
+  .slice(argv.start, argv.end);
+
+testRunner.run(todoTests, {verbose: argv.verbose});